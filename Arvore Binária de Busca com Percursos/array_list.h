@@ -2,21 +2,67 @@
 #ifndef STRUCTURES_ARRAY_LIST_H
 #define STRUCTURES_ARRAY_LIST_H
 
+#include <algorithm>  // std::move, std::move_backward
 #include <cstdint>
+#include <cstring>  // std::memcpy, std::memmove
+#include <memory>  // std::allocator_traits, std::uninitialized_copy
+#include <new>  // placement new
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_trivially_copyable
+#include <utility>  // std::move, std::forward, std::swap
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
 
+#include "simd_search.h"
 
 namespace structures {
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class ArrayList {
  public:
+    /// Iteradores de acesso aleatorio: ponteiros para o vetor
+    using value_type = T;
+    using allocator_type = Allocator;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /// Lista que cresce sob demanda, comecando com DEFAULT_MAX posicoes
     ArrayList();
+    /// Lista de capacidade fixa
     explicit ArrayList(std::size_t max_size);
+    /// Capacidade inicial, modo de crescimento e alocador
+    ArrayList(std::size_t max_size, bool growable,
+              const Allocator& allocator = Allocator());
+    /// Lista que cresce sob demanda, alocando com allocator
+    explicit ArrayList(const Allocator& allocator);
+    /// Copia profunda: uma alocacao e uma copia em bloco
+    ArrayList(const ArrayList& other);
+    /// Copia profunda alocando com allocator
+    ArrayList(const ArrayList& other, const Allocator& allocator);
+    /// Toma o vetor de other em O(1); other fica vazia e sem capacidade
+    ArrayList(ArrayList&& other) noexcept;
     ~ArrayList();
+    /// Copia os elementos; o alocador de cada lista nao muda
+    ArrayList& operator=(const ArrayList& other);
+    /// O(1) se o vetor puder trocar de dono; senao move os elementos
+    ArrayList& operator=(ArrayList&& other);
+    /// Troca o conteudo com other em O(1)
+    void swap(ArrayList& other) noexcept;
+    /// Alocador do vetor
+    Allocator get_allocator() const;
+
     void clear();
     void push_back(const T& data);
+    void push_back(T&& data);
     void push_front(const T& data);
+    void push_front(T&& data);
     void insert(const T& data, std::size_t index);
+    void insert(T&& data, std::size_t index);
+    template<typename... Args>
+    T& emplace(std::size_t index, Args&&... args);
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
     void insert_sorted(const T& data);
     T pop(std::size_t index);
     T pop_back();
@@ -26,155 +72,332 @@ class ArrayList {
     bool empty() const;
     bool contains(const T& data) const;
     std::size_t find(const T& data) const;
+    /// Quantidade de elementos iguais a data
+    std::size_t count(const T& data) const;
+    /// Menor elemento
+    T min() const;
+    /// Maior elemento
+    T max() const;
     std::size_t size() const;
     std::size_t max_size() const;
+    /// Posicoes alocadas (o mesmo que max_size)
+    std::size_t capacity() const;
+    /// Cresce ao encher
+    bool growable() const;
+    /// Fator de crescimento geometrico
+    double growth_factor() const;
+    /// Altera o fator de crescimento (maior que 1)
+    void growth_factor(double factor);
+    /// Garante capacidade para ao menos n elementos
+    void reserve(std::size_t n);
+    /// Reduz a capacidade ao tamanho atual
+    void shrink_to_fit();
     T& at(std::size_t index);
     T& operator[](std::size_t index);
     const T& at(std::size_t index) const;
     const T& operator[](std::size_t index) const;
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
 
  private:
+    /// Abre espaco na posicao index, que fica sem elemento construido.
+    void shift_right(std::size_t index);
+    /// Fecha o espaco da posicao index, cujo elemento ja foi movido.
+    void shift_left(std::size_t index);
+    /// Cresce se estiver sem espaco para mais um elemento
+    void grow_if_needed();
+    /// Realoca o vetor com nova capacidade
+    void reallocate(std::size_t new_size);
+    T* allocate(std::size_t n);
+    void deallocate(T* p, std::size_t n);
+    /// Toma o vetor de other, que fica vazia e sem capacidade
+    void steal(ArrayList& other) noexcept;
+    /// Movimento quando o alocador acompanha o vetor
+    void move_assign(ArrayList& other, std::true_type);
+    /// Movimento quando o alocador fica: so toma o vetor se for igual
+    void move_assign(ArrayList& other, std::false_type);
+    /// Troca os alocadores, se eles acompanham a troca
+    void swap_allocator(ArrayList& other, std::true_type) noexcept;
+    void swap_allocator(ArrayList& other, std::false_type) noexcept;
+
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    Allocator allocator_;
     T* contents;
     std::size_t size_;
     std::size_t max_size_;
+    bool growable_{false};
+    double growth_factor_{DEFAULT_GROWTH_FACTOR};
 
     static const auto DEFAULT_MAX = 10u;
+    static constexpr double DEFAULT_GROWTH_FACTOR = 2.0;
 };
 
-}  // namespace structures
-
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Lista que aloca de um std::pmr::memory_resource
+template<typename T>
+using ArrayList =
+    structures::ArrayList<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 #endif
 
-template<typename T>
-structures::ArrayList<T>::ArrayList() {
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList() {
     max_size_ = DEFAULT_MAX;
-    contents = new T[max_size_];
+    contents = allocate(max_size_);
     size_ = -1;
+    growable_ = true;
 }
 
-template<typename T>
-structures::ArrayList<T>::ArrayList(std::size_t max_size) {
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(std::size_t max_size) {
     max_size_ = max_size;
-    contents = new T[max_size_];
+    contents = allocate(max_size_);
     size_ = -1;
 }
 
-template<typename T>
-structures::ArrayList<T>::~ArrayList() {
-    delete [] contents;
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(std::size_t max_size,
+                                               bool growable,
+                                               const Allocator& allocator):
+    allocator_{allocator} {
+    max_size_ = max_size;
+    contents = allocate(max_size_);
+    size_ = -1;
+    growable_ = growable;
 }
 
-
-template<typename T>
-void structures::ArrayList<T>::clear() {
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(const Allocator& allocator):
+    allocator_{allocator} {
+    max_size_ = DEFAULT_MAX;
+    contents = allocate(max_size_);
     size_ = -1;
+    growable_ = true;
 }
 
-template<typename T>
-void structures::ArrayList<T>::push_back(const T& data) {
-    if (full()) {
-        throw std::out_of_range("lista cheia");
-    } else {
-        size_++;
-        contents[size_] = data;
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(const ArrayList& other):
+    ArrayList(other,
+              AllocatorTraits::select_on_container_copy_construction(
+                  other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(const ArrayList& other,
+                                               const Allocator& allocator):
+    allocator_{allocator} {
+    max_size_ = other.max_size_;
+    contents = allocate(max_size_);
+    try {
+        // Para tipos triviais vira um unico memmove.
+        std::uninitialized_copy(other.begin(), other.end(), contents);
+    } catch (...) {
+        deallocate(contents, max_size_);
+        throw;
     }
+    size_ = other.size_;
+    growable_ = other.growable_;
+    growth_factor_ = other.growth_factor_;
 }
 
-template<typename T>
-void structures::ArrayList<T>::push_front(const T& data) {
-    if (full()) {
-        throw std::out_of_range("lista cheia");
-    } else {
-        size_++;
-        std::size_t position = size_;
-        while (position > 0) {
-            contents[position] = contents[position - 1];
-            position--;
-        }
-        contents[0] = data;
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::ArrayList(ArrayList&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>::~ArrayList() {
+    clear();
+    deallocate(contents, max_size_);
+}
+
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>&
+structures::ArrayList<T, Allocator>::operator=(const ArrayList& other) {
+    if (this != &other) {
+        ArrayList copy(other, allocator_);
+        swap(copy);
     }
+    return *this;
 }
 
+template<typename T, typename Allocator>
+structures::ArrayList<T, Allocator>&
+structures::ArrayList<T, Allocator>::operator=(ArrayList&& other) {
+    if (this != &other) {
+        move_assign(other, typename AllocatorTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
 
-template<typename T>
-void structures::ArrayList<T>::insert(const T& data, std::size_t index) {
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::swap(ArrayList& other) noexcept {
+    std::swap(contents, other.contents);
+    std::swap(size_, other.size_);
+    std::swap(max_size_, other.max_size_);
+    std::swap(growable_, other.growable_);
+    std::swap(growth_factor_, other.growth_factor_);
+    swap_allocator(other,
+                   typename AllocatorTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::ArrayList<T, Allocator>::get_allocator() const {
+    return allocator_;
+}
+
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::clear() {
+    while (size_ + 1 > 0) {
+        contents[size_].~T();
+        size_--;
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::push_front(const T& data) {
+    emplace(0, data);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::push_front(T&& data) {
+    emplace(0, std::move(data));
+}
+
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::insert(const T& data,
+                                                 std::size_t index) {
+    emplace(index, data);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::insert(T&& data,
+                                                 std::size_t index) {
+    emplace(index, std::move(data));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+T& structures::ArrayList<T, Allocator>::emplace(std::size_t index,
+                                                Args&&... args) {
+    if (index == size_ + 1) {
+        return emplace_back(std::forward<Args>(args)...);
+    }
     if (full()) {
         throw std::out_of_range("lista cheia");
     } else {
         if (index > size_ + 1 || index < 0) {
             throw std::out_of_range("posicao invalida");
         }
+        // Constroi antes de deslocar: args pode referenciar a propria lista.
+        T value(std::forward<Args>(args)...);
+        grow_if_needed();
+        shift_right(index);
+        T* slot = new (contents + index) T(std::move(value));
         size_++;
-        std::size_t position = size_;
-        while (position > index) {
-            contents[position] = contents[position - 1];
-            position--;
-        }
-        contents[index] = data;
+        return *slot;
     }
 }
 
-template<typename T>
-void structures::ArrayList<T>::insert_sorted(const T& data) {
+template<typename T, typename Allocator>
+template<typename... Args>
+T& structures::ArrayList<T, Allocator>::emplace_back(Args&&... args) {
+    if (full()) {
+        throw std::out_of_range("lista cheia");
+    } else if (size() == max_size_) {
+        // Constroi antes de realocar: args pode referenciar a propria lista.
+        T value(std::forward<Args>(args)...);
+        grow_if_needed();
+        T* slot = new (contents + size_ + 1) T(std::move(value));
+        size_++;
+        return *slot;
+    } else {
+        T* slot = new (contents + size_ + 1) T(std::forward<Args>(args)...);
+        size_++;
+        return *slot;
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::insert_sorted(const T& data) {
     if (full()) {
         throw std::out_of_range("lista cheia");
     } else {
-        std::size_t position = 0;
-        while (position < size_ + 1 && data > contents[position]) {
-            position++;
+        // Busca binaria da primeira posicao que nao e menor que data.
+        std::size_t low = 0;
+        std::size_t high = size_ + 1;
+        while (low < high) {
+            std::size_t middle = low + (high - low) / 2;
+            if (data > contents[middle]) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
         }
-        insert(data, position);
+        insert(data, low);
     }
 }
 
-template<typename T>
-T structures::ArrayList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::ArrayList<T, Allocator>::pop(std::size_t index) {
     if (index > size_ || index < 0) {
         throw std::out_of_range("posicao invalida");
     } else {
         if (empty()) {
             throw std::out_of_range("lista vazia");
         } else {
-            size_--;
-            T value = contents[index];
-            std::size_t position = index;
-            while (position <= size_) {
-                contents[position] = contents[position + 1];
-                position++;
-            }
+            T value = std::move(contents[index]);
+            shift_left(index);
             return value;
         }
     }
 }
 
-template<typename T>
-T structures::ArrayList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::ArrayList<T, Allocator>::pop_back() {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
+        T value = std::move(contents[size_]);
+        contents[size_].~T();
         size_--;
-        return contents[size_ + 1];
+        return value;
     }
 }
 
-template<typename T>
-T structures::ArrayList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::ArrayList<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
-        size_--;
-        T value = contents[0];
-        std::size_t position = 0;
-        while (position < size_ + 1) {
-            contents[position] = contents[position + 1];
-            position++;
-        }
+        T value = std::move(contents[0]);
+        shift_left(0);
         return value;
     }
 }
 
-template<typename T>
-void structures::ArrayList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::remove(const T& data) {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
@@ -187,49 +410,96 @@ void structures::ArrayList<T>::remove(const T& data) {
     }
 }
 
-template<typename T>
-bool structures::ArrayList<T>::full() const {
-    return (size_ + 1 == max_size_);
+template<typename T, typename Allocator>
+bool structures::ArrayList<T, Allocator>::full() const {
+    return (!growable_ && size_ + 1 == max_size_);
 }
 
-template<typename T>
-bool structures::ArrayList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::ArrayList<T, Allocator>::empty() const {
     return (size_ + 1 == 0);
 }
 
-template<typename T>
-bool structures::ArrayList<T>::contains(const T& data) const {
-    std::size_t position = 0;
-    while (position <= size_) {
-        if (contents[position] == data) {
-            return true;
-        }
-        position++;
+template<typename T, typename Allocator>
+bool structures::ArrayList<T, Allocator>::contains(const T& data) const {
+    return find(data) != size();
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::find(const T& data) const {
+    return simd::find(contents, size(), data);
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::count(const T& data) const {
+    return simd::count(contents, size(), data);
+}
+
+template<typename T, typename Allocator>
+T structures::ArrayList<T, Allocator>::min() const {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
     }
-    return false;
+    return simd::min(contents, size());
 }
 
-template<typename T>
-std::size_t structures::ArrayList<T>::find(const T& data) const {
-    std::size_t position = 0;
-    while (position <= size_ && data != contents[position]) {
-        position++;
+template<typename T, typename Allocator>
+T structures::ArrayList<T, Allocator>::max() const {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
     }
-    return position;
+    return simd::max(contents, size());
 }
 
-template<typename T>
-std::size_t structures::ArrayList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::size() const {
     return (size_ + 1);
 }
 
-template<typename T>
-std::size_t structures::ArrayList<T>::max_size() const {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::max_size() const {
     return max_size_;
 }
 
-template<typename T>
-T& structures::ArrayList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayList<T, Allocator>::capacity() const {
+    return max_size_;
+}
+
+template<typename T, typename Allocator>
+bool structures::ArrayList<T, Allocator>::growable() const {
+    return growable_;
+}
+
+template<typename T, typename Allocator>
+double structures::ArrayList<T, Allocator>::growth_factor() const {
+    return growth_factor_;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::growth_factor(double factor) {
+    if (!(factor > 1.0)) {
+        throw std::invalid_argument("fator de crescimento invalido");
+    }
+    growth_factor_ = factor;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::reserve(std::size_t n) {
+    if (n > max_size_) {
+        reallocate(n);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::shrink_to_fit() {
+    if (size() < max_size_) {
+        reallocate(size());
+    }
+}
+
+template<typename T, typename Allocator>
+T& structures::ArrayList<T, Allocator>::at(std::size_t index) {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
@@ -241,13 +511,13 @@ T& structures::ArrayList<T>::at(std::size_t index) {
     }
 }
 
-template<typename T>
-T& structures::ArrayList<T>::operator[](std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::ArrayList<T, Allocator>::operator[](std::size_t index) {
     return contents[index];
 }
 
-template<typename T>
-const T& structures::ArrayList<T>::at(std::size_t index) const {
+template<typename T, typename Allocator>
+const T& structures::ArrayList<T, Allocator>::at(std::size_t index) const {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
@@ -259,7 +529,159 @@ const T& structures::ArrayList<T>::at(std::size_t index) const {
     }
 }
 
-template<typename T>
-const T& structures::ArrayList<T>::operator[](std::size_t index) const {
+template<typename T, typename Allocator>
+const T& structures::ArrayList<T, Allocator>::operator[](
+        std::size_t index) const {
     return contents[index];
 }
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::iterator
+structures::ArrayList<T, Allocator>::begin() {
+    return contents;
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::iterator
+structures::ArrayList<T, Allocator>::end() {
+    return contents + size();
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::const_iterator
+structures::ArrayList<T, Allocator>::begin() const {
+    return contents;
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayList<T, Allocator>::const_iterator
+structures::ArrayList<T, Allocator>::end() const {
+    return contents + size();
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::shift_right(std::size_t index) {
+    std::size_t position = size_ + 1;
+    if (std::is_trivially_copyable<T>::value) {
+        // Sem construtores a chamar: um unico memmove.
+        std::memmove(static_cast<void*>(contents + index + 1),
+                     static_cast<const void*>(contents + index),
+                     (position - index) * sizeof(T));
+        return;
+    }
+    new (contents + position) T(std::move(contents[position - 1]));
+    // Um unico bloco: [index, size_) vai para [index + 1, size_ + 1).
+    std::move_backward(contents + index, contents + size_,
+                       contents + position);
+    contents[index].~T();
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::shift_left(std::size_t index) {
+    if (std::is_trivially_copyable<T>::value) {
+        std::memmove(static_cast<void*>(contents + index),
+                     static_cast<const void*>(contents + index + 1),
+                     (size_ - index) * sizeof(T));
+        size_--;
+        return;
+    }
+    // Um unico bloco: (index, size_] vai para [index, size_).
+    std::move(contents + index + 1, contents + size_ + 1, contents + index);
+    contents[size_].~T();
+    size_--;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::grow_if_needed() {
+    if (growable_ && size() == max_size_) {
+        std::size_t new_size =
+            static_cast<std::size_t>(max_size_ * growth_factor_);
+        reallocate(new_size > max_size_ ? new_size : max_size_ + 1);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::reallocate(std::size_t new_size) {
+    T* new_contents = allocate(new_size);
+    std::size_t count = size();
+    if (std::is_trivially_copyable<T>::value) {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(new_contents),
+                        static_cast<const void*>(contents),
+                        count * sizeof(T));
+        }
+    } else {
+        for (std::size_t i = 0; i < count; i++) {
+            new (new_contents + i) T(std::move(contents[i]));
+            contents[i].~T();
+        }
+    }
+    deallocate(contents, max_size_);
+    contents = new_contents;
+    max_size_ = new_size;
+}
+
+template<typename T, typename Allocator>
+T* structures::ArrayList<T, Allocator>::allocate(std::size_t n) {
+    return AllocatorTraits::allocate(allocator_, n);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::deallocate(T* p, std::size_t n) {
+    // Lista movida nao tem vetor.
+    if (p != nullptr) {
+        AllocatorTraits::deallocate(allocator_, p, n);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::steal(ArrayList& other) noexcept {
+    contents = other.contents;
+    size_ = other.size_;
+    max_size_ = other.max_size_;
+    growable_ = other.growable_;
+    growth_factor_ = other.growth_factor_;
+    other.contents = nullptr;
+    other.size_ = -1;
+    other.max_size_ = 0;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::move_assign(ArrayList& other,
+                                                      std::true_type) {
+    clear();
+    deallocate(contents, max_size_);
+    allocator_ = std::move(other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::move_assign(ArrayList& other,
+                                                      std::false_type) {
+    clear();
+    if (allocator_ == other.allocator_) {
+        deallocate(contents, max_size_);
+        steal(other);
+        return;
+    }
+    // O vetor de other nao pode ser liberado por este alocador.
+    reserve(other.size());
+    for (T& data : other) {
+        emplace_back(std::move(data));
+    }
+    growable_ = other.growable_;
+    growth_factor_ = other.growth_factor_;
+    other.clear();
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::swap_allocator(
+        ArrayList& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayList<T, Allocator>::swap_allocator(
+        ArrayList&, std::false_type) noexcept {}
+
+#endif
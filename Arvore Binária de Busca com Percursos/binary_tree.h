@@ -2,16 +2,149 @@
 #ifndef STRUCTURES_BINARY_TREE_H
 #define STRUCTURES_BINARY_TREE_H
 
+#include <cstddef>  // std::ptrdiff_t
+#include <iterator>  // std::bidirectional_iterator_tag
+#include <memory>  // std::allocator, std::allocator_traits
+#include <type_traits>  // std::true_type, std::false_type
+#include <utility>  // std::move, std::swap
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
+
 #include "array_list.h"
 
 namespace structures {
 
 /// Arvore Binaria
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class BinaryTree {
+    struct Node;
+
  public:
+    using allocator_type = Allocator;
+
+    /// Iterador bidirecional em ordem (esquerda, raiz, direita). Guarda o
+    /// caminho da raiz até o nodo atual, já que os nodos não conhecem o
+    /// pai; os dados são somente leitura para não quebrar a ordem.
+    class Iterator {
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iterator() {}
+
+        reference operator*() const {
+            return path.back()->data;
+        }
+        pointer operator->() const {
+            return &path.back()->data;
+        }
+        Iterator& operator++() {
+            const Node* node = path.back();
+            if (node->right != nullptr) {
+                path.push_back(node->right);
+                descend_left();
+            } else {
+                // Sobe enquanto vier da direita.
+                const Node* child;
+                do {
+                    child = path.back();
+                    path.pop_back();
+                } while (!path.empty() && path.back()->right == child);
+            }
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+        /// A partir de end() volta ao maior
+        Iterator& operator--() {
+            if (path.empty()) {
+                if (root != nullptr) {
+                    path.push_back(root);
+                    descend_right();
+                }
+                return *this;
+            }
+            const Node* node = path.back();
+            if (node->left != nullptr) {
+                path.push_back(node->left);
+                descend_right();
+            } else {
+                // Sobe enquanto vier da esquerda.
+                const Node* child;
+                do {
+                    child = path.back();
+                    path.pop_back();
+                } while (!path.empty() && path.back()->left == child);
+            }
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.current() == b.current();
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.current() != b.current();
+        }
+
+     private:
+        friend class BinaryTree;
+
+        explicit Iterator(const Node* root_):
+            root{root_}
+        {}
+
+        const Node* current() const {
+            return path.empty() ? nullptr : path.back();
+        }
+        void descend_left() {
+            while (path.back()->left != nullptr) {
+                path.push_back(path.back()->left);
+            }
+        }
+        void descend_right() {
+            while (path.back()->right != nullptr) {
+                path.push_back(path.back()->right);
+            }
+        }
+
+        const Node* root{nullptr};
+        std::vector<const Node*> path;
+    };
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    /// Construtor.
+    BinaryTree() = default;
+    /// Construtor com alocador.
+    explicit BinaryTree(const Allocator& allocator);
+    /// Construtor de cópia: copia a forma da árvore em O(n).
+    BinaryTree(const BinaryTree& other);
+    /// Construtor de cópia alocando com allocator.
+    BinaryTree(const BinaryTree& other, const Allocator& allocator);
+    /// Construtor de movimento: toma os nodos e o alocador de other em O(1).
+    BinaryTree(BinaryTree&& other) noexcept;
     /// Destrutor.
     ~BinaryTree();
+    /// Atribuição por cópia; o alocador de cada árvore não muda.
+    BinaryTree& operator=(const BinaryTree& other);
+    /// Atribuição por movimento: O(1) se os nodos puderem trocar de dono.
+    BinaryTree& operator=(BinaryTree&& other);
+    /// Troca o conteúdo com other em O(1).
+    void swap(BinaryTree& other) noexcept;
+    /// Alocador dos nodos.
+    Allocator get_allocator() const;
     /// Insere o elemento na arvore.
     void insert(const T& data);
     /// Remove o elemento da arvore.
@@ -28,6 +161,10 @@ class BinaryTree {
     ArrayList<T> in_order() const;
     /// Retorna os elementos na ordem esquerda, direita e raiz.
     ArrayList<T> post_order() const;
+    /// Menor elemento
+    const_iterator begin() const;
+    /// Depois do maior elemento
+    const_iterator end() const;
 
  private:
     struct Node {
@@ -35,29 +172,29 @@ class BinaryTree {
             data = data_;
         }
 
-        void insert(const T& data_) {
+        void insert(const T& data_, BinaryTree& tree) {
             if (data_ < data) {
                 // Insere a esquerda.
                 if (left == nullptr) {
-                    left = new Node(data_);
+                    left = tree.create_node(data_);
                 } else {
-                    left->insert(data_);
+                    left->insert(data_, tree);
                 }
             } else {
                 // Insere a direita.
                 if (right == nullptr) {
-                    right = new Node(data_);
+                    right = tree.create_node(data_);
                 } else {
-                    right->insert(data_);
+                    right->insert(data_, tree);
                 }
             }
         }
 
-        Node* remove(const T& data_) {
+        Node* remove(const T& data_, BinaryTree& tree) {
             if (data_ < data) {
                 // Vai à esquerda.
                 if (left != nullptr) {
-                    left = left->remove(data_);
+                    left = left->remove(data_, tree);
                     return this;
                 } else {
                     return nullptr;
@@ -65,7 +202,7 @@ class BinaryTree {
             } else if (data_ > data) {
                 // Vai à direita.
                 if (right != nullptr) {
-                    right = right->remove(data_);
+                    right = right->remove(data_, tree);
                     return this;
                 } else {
                     return nullptr;
@@ -75,21 +212,21 @@ class BinaryTree {
                     // 2 filhos.
                     Node* temp = right->minimum();
                     data = temp->data;
-                    right = right->remove(data);
+                    right = right->remove(data, tree);
                     return this;
                 } else if (right != nullptr) {
                     // 1 filho à direita.
                     Node* temp = right;
-                    delete this;
+                    tree.destroy_node(this);
                     return temp;
                 } else if (left != nullptr) {
                     // 1 filho à esquerda.
                     Node* temp = left;
-                    delete this;
+                    tree.destroy_node(this);
                     return temp;
                 } else {
                     // Folha.
-                    delete this;
+                    tree.destroy_node(this);
                     return nullptr;
                 }
             }
@@ -154,21 +291,116 @@ class BinaryTree {
             }
         }
 
+        Node* clone(BinaryTree& tree) const {
+            Node* node = tree.create_node(data);
+            if (left != nullptr) {
+                node->left = left->clone(tree);
+            }
+            if (right != nullptr) {
+                node->right = right->clone(tree);
+            }
+            return node;
+        }
+
         T data;
         Node* left{nullptr};
         Node* right{nullptr};
     };
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
 
+    /// Aloca e constrói um nodo.
+    Node* create_node(const T& data);
+    /// Destrói e libera um nodo.
+    void destroy_node(Node* node);
+    /// Troca os nodos com other, sem mexer nos alocadores.
+    void steal(BinaryTree& other) noexcept;
+    /// Movimento quando o alocador acompanha os nodos.
+    void move_assign(BinaryTree& other, std::true_type);
+    /// Movimento quando o alocador fica: só toma os nodos se for igual.
+    void move_assign(BinaryTree& other, std::false_type);
+    /// Troca os alocadores, se eles acompanham a troca.
+    void swap_allocator(BinaryTree& other, std::true_type) noexcept;
+    void swap_allocator(BinaryTree& other, std::false_type) noexcept;
+
+    NodeAllocator allocator_;
     Node* root{nullptr};
     std::size_t size_{0};
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Árvore que aloca os nodos de um std::pmr::memory_resource
+template<typename T>
+using BinaryTree =
+    structures::BinaryTree<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
-#endif
+template<typename T, typename Allocator>
+structures::BinaryTree<T, Allocator>::BinaryTree(const Allocator& allocator):
+    allocator_{allocator}
+{}
 
-template<typename T>
-structures::BinaryTree<T>::~BinaryTree() {
+template<typename T, typename Allocator>
+structures::BinaryTree<T, Allocator>::BinaryTree(const BinaryTree& other):
+    BinaryTree(other, NodeTraits::select_on_container_copy_construction(
+        other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::BinaryTree<T, Allocator>::BinaryTree(const BinaryTree& other,
+                                                 const Allocator& allocator):
+    allocator_{allocator} {
+    if (other.root != nullptr) {
+        root = other.root->clone(*this);
+    }
+    size_ = other.size_;
+}
+
+template<typename T, typename Allocator>
+structures::BinaryTree<T, Allocator>::BinaryTree(BinaryTree&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::BinaryTree<T, Allocator>&
+structures::BinaryTree<T, Allocator>::operator=(const BinaryTree& other) {
+    if (this != &other) {
+        BinaryTree copy(other, get_allocator());
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::BinaryTree<T, Allocator>&
+structures::BinaryTree<T, Allocator>::operator=(BinaryTree&& other) {
+    if (this != &other) {
+        move_assign(other, typename NodeTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::swap(BinaryTree& other) noexcept {
+    steal(other);
+    swap_allocator(other,
+                   typename NodeTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::BinaryTree<T, Allocator>::get_allocator() const {
+    return Allocator(allocator_);
+}
+
+template<typename T, typename Allocator>
+structures::BinaryTree<T, Allocator>::~BinaryTree() {
     if (root != nullptr) {
         structures::ArrayList<T> list_nodes = pre_order();
         while (!list_nodes.empty()) {
@@ -177,13 +409,13 @@ structures::BinaryTree<T>::~BinaryTree() {
     }
 }
 
-template<typename T>
-void structures::BinaryTree<T>::insert(const T& data) {
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::insert(const T& data) {
     if (!contains(data)) {
         if (root != nullptr) {
-            root->insert(data);
+            root->insert(data, *this);
         } else {
-            root = new Node(data);
+            root = create_node(data);
         }
         size_++;
     } else {
@@ -191,11 +423,11 @@ void structures::BinaryTree<T>::insert(const T& data) {
     }
 }
 
-template<typename T>
-void structures::BinaryTree<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::remove(const T& data) {
     if (root != nullptr) {
         if (contains(data)) {
-            root->remove(data);
+            root = root->remove(data, *this);
             size_--;
         } else {
             throw std::out_of_range("Elemento inválido.");
@@ -205,8 +437,8 @@ void structures::BinaryTree<T>::remove(const T& data) {
     }
 }
 
-template<typename T>
-bool structures::BinaryTree<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::BinaryTree<T, Allocator>::contains(const T& data) const {
     if (root != nullptr) {
         return root->contains(data);
     } else {
@@ -214,39 +446,118 @@ bool structures::BinaryTree<T>::contains(const T& data) const {
     }
 }
 
-template<typename T>
-bool structures::BinaryTree<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::BinaryTree<T, Allocator>::empty() const {
     return (size_ == 0);
 }
 
-template<typename T>
-std::size_t structures::BinaryTree<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::BinaryTree<T, Allocator>::size() const {
     return size_;
 }
 
-template<typename T>
-structures::ArrayList<T> structures::BinaryTree<T>::pre_order() const {
-    structures::ArrayList<T> v;
+template<typename T, typename Allocator>
+structures::ArrayList<T>
+structures::BinaryTree<T, Allocator>::pre_order() const {
+    structures::ArrayList<T> v(size_, true);
     if (root != nullptr) {
         root->pre_order(v);
     }
     return v;
 }
 
-template<typename T>
-structures::ArrayList<T> structures::BinaryTree<T>::in_order() const {
-    structures::ArrayList<T> v;
+template<typename T, typename Allocator>
+structures::ArrayList<T>
+structures::BinaryTree<T, Allocator>::in_order() const {
+    structures::ArrayList<T> v(size_, true);
     if (root != nullptr) {
         root->in_order(v);
     }
     return v;
 }
 
-template<typename T>
-structures::ArrayList<T> structures::BinaryTree<T>::post_order() const {
-    structures::ArrayList<T> v;
+template<typename T, typename Allocator>
+structures::ArrayList<T>
+structures::BinaryTree<T, Allocator>::post_order() const {
+    structures::ArrayList<T> v(size_, true);
     if (root != nullptr) {
         root->post_order(v);
     }
     return v;
 }
+
+template<typename T, typename Allocator>
+typename structures::BinaryTree<T, Allocator>::const_iterator
+structures::BinaryTree<T, Allocator>::begin() const {
+    const_iterator it(root);
+    if (root != nullptr) {
+        it.path.push_back(root);
+        it.descend_left();
+    }
+    return it;
+}
+
+template<typename T, typename Allocator>
+typename structures::BinaryTree<T, Allocator>::const_iterator
+structures::BinaryTree<T, Allocator>::end() const {
+    return const_iterator(root);
+}
+
+template<typename T, typename Allocator>
+typename structures::BinaryTree<T, Allocator>::Node*
+structures::BinaryTree<T, Allocator>::create_node(const T& data) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, data);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::steal(BinaryTree& other) noexcept {
+    std::swap(root, other.root);
+    std::swap(size_, other.size_);
+}
+
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::move_assign(BinaryTree& other,
+                                                       std::true_type) {
+    // Os nodos antigos são destruídos junto com old, pelo alocador antigo.
+    BinaryTree old(std::move(other));
+    steal(old);
+    std::swap(allocator_, old.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::move_assign(BinaryTree& other,
+                                                       std::false_type) {
+    BinaryTree old(std::move(other));
+    if (allocator_ == old.allocator_) {
+        steal(old);
+    } else {
+        // Nodos de outro alocador não podem ser liberados por este.
+        BinaryTree copy(old, get_allocator());
+        steal(copy);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::swap_allocator(
+        BinaryTree& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::BinaryTree<T, Allocator>::swap_allocator(
+        BinaryTree&, std::false_type) noexcept {}
+
+#endif
@@ -0,0 +1,584 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_SIMD_SEARCH_H
+#define STRUCTURES_SIMD_SEARCH_H
+
+#include <cstdint>
+#include <stdexcept>  // C++ exceptions
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define STRUCTURES_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define STRUCTURES_SIMD_X86 0
+#endif
+
+namespace structures {
+namespace simd {
+
+/// Busca, contagem, mínimo e máximo sobre vetores contíguos. Para int,
+/// float, double e ponteiros usam AVX2 ou SSE4.2 conforme a CPU (escolha
+/// feita uma vez, em tempo de execução); os demais tipos e CPUs usam o
+/// laço comum. min/max assumem que não há NaN.
+
+/// Posição do primeiro igual a value, ou n se não houver
+template<typename T>
+std::size_t find(const T* data, std::size_t n, const T& value);
+/// Quantidade de iguais a value
+template<typename T>
+std::size_t count(const T* data, std::size_t n, const T& value);
+/// Menor elemento (n > 0)
+template<typename T>
+T min(const T* data, std::size_t n);
+/// Maior elemento (n > 0)
+template<typename T>
+T max(const T* data, std::size_t n);
+
+template<typename U>
+std::size_t find(U* const* data, std::size_t n, U* const& value);
+template<typename U>
+std::size_t count(U* const* data, std::size_t n, U* const& value);
+
+inline std::size_t find(const int* data, std::size_t n,
+                        const int& value);
+inline std::size_t count(const int* data, std::size_t n,
+                         const int& value);
+inline int min(const int* data, std::size_t n);
+inline int max(const int* data, std::size_t n);
+
+inline std::size_t find(const float* data, std::size_t n,
+                        const float& value);
+inline std::size_t count(const float* data, std::size_t n,
+                         const float& value);
+inline float min(const float* data, std::size_t n);
+inline float max(const float* data, std::size_t n);
+
+inline std::size_t find(const double* data, std::size_t n,
+                        const double& value);
+inline std::size_t count(const double* data, std::size_t n,
+                         const double& value);
+inline double min(const double* data, std::size_t n);
+inline double max(const double* data, std::size_t n);
+
+namespace detail {
+
+/// Laços comuns, a partir de begin (usados também para as sobras)
+template<typename T>
+std::size_t find_from(const T* data, std::size_t begin, std::size_t n,
+                      const T& value) {
+    for (std::size_t i = begin; i < n; i++) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return n;
+}
+
+template<typename T>
+std::size_t count_from(const T* data, std::size_t begin, std::size_t n,
+                       const T& value) {
+    std::size_t result = 0;
+    for (std::size_t i = begin; i < n; i++) {
+        result += (data[i] == value) ? 1 : 0;
+    }
+    return result;
+}
+
+template<typename T>
+T min_from(const T* data, std::size_t begin, std::size_t n, T best) {
+    for (std::size_t i = begin; i < n; i++) {
+        if (data[i] < best) {
+            best = data[i];
+        }
+    }
+    return best;
+}
+
+template<typename T>
+T max_from(const T* data, std::size_t begin, std::size_t n, T best) {
+    for (std::size_t i = begin; i < n; i++) {
+        if (best < data[i]) {
+            best = data[i];
+        }
+    }
+    return best;
+}
+
+#if STRUCTURES_SIMD_X86
+
+enum class Level { SCALAR, SSE42, AVX2 };
+
+/// Melhor conjunto de instruções disponível, detectado uma única vez
+inline Level level() {
+    static const Level detected =
+        __builtin_cpu_supports("avx2") ? Level::AVX2 :
+        __builtin_cpu_supports("sse4.2") ? Level::SSE42 : Level::SCALAR;
+    return detected;
+}
+
+#define STRUCTURES_AVX2 __attribute__((target("avx2"), always_inline))
+#define STRUCTURES_SSE42 __attribute__((target("sse4.2"), always_inline))
+
+/// Operações por tipo e conjunto de instruções usadas pelos núcleos
+struct Avx2Int32 {
+    using T = int;
+    using V = __m256i;
+    static const std::size_t WIDTH = 8;
+    STRUCTURES_AVX2 static V load(const void* p) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    }
+    STRUCTURES_AVX2 static void store(T* p, V v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    STRUCTURES_AVX2 static V set1(T v) { return _mm256_set1_epi32(v); }
+    STRUCTURES_AVX2 static unsigned eq(V a, V b) {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(a, b)));
+    }
+    STRUCTURES_AVX2 static V min(V a, V b) { return _mm256_min_epi32(a, b); }
+    STRUCTURES_AVX2 static V max(V a, V b) { return _mm256_max_epi32(a, b); }
+};
+
+struct Avx2Float {
+    using T = float;
+    using V = __m256;
+    static const std::size_t WIDTH = 8;
+    STRUCTURES_AVX2 static V load(const void* p) {
+        return _mm256_loadu_ps(static_cast<const float*>(p));
+    }
+    STRUCTURES_AVX2 static void store(T* p, V v) { _mm256_storeu_ps(p, v); }
+    STRUCTURES_AVX2 static V set1(T v) { return _mm256_set1_ps(v); }
+    STRUCTURES_AVX2 static unsigned eq(V a, V b) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+    }
+    STRUCTURES_AVX2 static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    STRUCTURES_AVX2 static V max(V a, V b) { return _mm256_max_ps(a, b); }
+};
+
+struct Avx2Double {
+    using T = double;
+    using V = __m256d;
+    static const std::size_t WIDTH = 4;
+    STRUCTURES_AVX2 static V load(const void* p) {
+        return _mm256_loadu_pd(static_cast<const double*>(p));
+    }
+    STRUCTURES_AVX2 static void store(T* p, V v) { _mm256_storeu_pd(p, v); }
+    STRUCTURES_AVX2 static V set1(T v) { return _mm256_set1_pd(v); }
+    STRUCTURES_AVX2 static unsigned eq(V a, V b) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ));
+    }
+    STRUCTURES_AVX2 static V min(V a, V b) { return _mm256_min_pd(a, b); }
+    STRUCTURES_AVX2 static V max(V a, V b) { return _mm256_max_pd(a, b); }
+};
+
+/// Ponteiros de 64 bits, comparados como inteiros (apenas igualdade)
+struct Avx2Int64 {
+    using T = long long;
+    using V = __m256i;
+    static const std::size_t WIDTH = 4;
+    STRUCTURES_AVX2 static V load(const void* p) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    }
+    STRUCTURES_AVX2 static V set1(T v) { return _mm256_set1_epi64x(v); }
+    STRUCTURES_AVX2 static unsigned eq(V a, V b) {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(
+            _mm256_cmpeq_epi64(a, b)));
+    }
+};
+
+struct Sse42Int32 {
+    using T = int;
+    using V = __m128i;
+    static const std::size_t WIDTH = 4;
+    STRUCTURES_SSE42 static V load(const void* p) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+    STRUCTURES_SSE42 static void store(T* p, V v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    STRUCTURES_SSE42 static V set1(T v) { return _mm_set1_epi32(v); }
+    STRUCTURES_SSE42 static unsigned eq(V a, V b) {
+        return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+    }
+    STRUCTURES_SSE42 static V min(V a, V b) { return _mm_min_epi32(a, b); }
+    STRUCTURES_SSE42 static V max(V a, V b) { return _mm_max_epi32(a, b); }
+};
+
+struct Sse42Float {
+    using T = float;
+    using V = __m128;
+    static const std::size_t WIDTH = 4;
+    STRUCTURES_SSE42 static V load(const void* p) {
+        return _mm_loadu_ps(static_cast<const float*>(p));
+    }
+    STRUCTURES_SSE42 static void store(T* p, V v) { _mm_storeu_ps(p, v); }
+    STRUCTURES_SSE42 static V set1(T v) { return _mm_set1_ps(v); }
+    STRUCTURES_SSE42 static unsigned eq(V a, V b) {
+        return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+    }
+    STRUCTURES_SSE42 static V min(V a, V b) { return _mm_min_ps(a, b); }
+    STRUCTURES_SSE42 static V max(V a, V b) { return _mm_max_ps(a, b); }
+};
+
+struct Sse42Double {
+    using T = double;
+    using V = __m128d;
+    static const std::size_t WIDTH = 2;
+    STRUCTURES_SSE42 static V load(const void* p) {
+        return _mm_loadu_pd(static_cast<const double*>(p));
+    }
+    STRUCTURES_SSE42 static void store(T* p, V v) { _mm_storeu_pd(p, v); }
+    STRUCTURES_SSE42 static V set1(T v) { return _mm_set1_pd(v); }
+    STRUCTURES_SSE42 static unsigned eq(V a, V b) {
+        return _mm_movemask_pd(_mm_cmpeq_pd(a, b));
+    }
+    STRUCTURES_SSE42 static V min(V a, V b) { return _mm_min_pd(a, b); }
+    STRUCTURES_SSE42 static V max(V a, V b) { return _mm_max_pd(a, b); }
+};
+
+struct Sse42Int64 {
+    using T = long long;
+    using V = __m128i;
+    static const std::size_t WIDTH = 2;
+    STRUCTURES_SSE42 static V load(const void* p) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+    STRUCTURES_SSE42 static V set1(T v) { return _mm_set1_epi64x(v); }
+    STRUCTURES_SSE42 static unsigned eq(V a, V b) {
+        return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b)));
+    }
+};
+
+/// Núcleos: tratam apenas os blocos completos de WIDTH elementos, ou
+/// seja, as posições [0, n - n % WIDTH); as sobras ficam com quem chama.
+/// Os dados são lidos por void* para servirem também a ponteiros.
+
+/// Posição do primeiro igual, ou o fim dos blocos completos
+template<typename Ops>
+__attribute__((target("avx2")))
+std::size_t find_avx2(const void* data, std::size_t n,
+                      typename Ops::T value) {
+    const char* bytes = static_cast<const char*>(data);
+    typename Ops::V target = Ops::set1(value);
+    std::size_t end = n - n % Ops::WIDTH;
+    for (std::size_t i = 0; i < end; i += Ops::WIDTH) {
+        unsigned mask = Ops::eq(Ops::load(bytes + i * sizeof(value)), target);
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return end;
+}
+
+template<typename Ops>
+__attribute__((target("avx2")))
+std::size_t count_avx2(const void* data, std::size_t n,
+                       typename Ops::T value) {
+    const char* bytes = static_cast<const char*>(data);
+    typename Ops::V target = Ops::set1(value);
+    std::size_t end = n - n % Ops::WIDTH;
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < end; i += Ops::WIDTH) {
+        unsigned mask = Ops::eq(Ops::load(bytes + i * sizeof(value)), target);
+        result += __builtin_popcount(mask);
+    }
+    return result;
+}
+
+/// Menor (Max = false) ou maior (Max = true) dos blocos completos
+/// (n >= WIDTH)
+template<typename Ops, bool Max>
+__attribute__((target("avx2")))
+typename Ops::T extreme_avx2(const typename Ops::T* data, std::size_t n) {
+    typename Ops::V best = Ops::load(data);
+    std::size_t end = n - n % Ops::WIDTH;
+    for (std::size_t i = Ops::WIDTH; i < end; i += Ops::WIDTH) {
+        typename Ops::V v = Ops::load(data + i);
+        best = Max ? Ops::max(best, v) : Ops::min(best, v);
+    }
+    typename Ops::T lanes[Ops::WIDTH];
+    Ops::store(lanes, best);
+    return Max ? max_from(lanes, 1, Ops::WIDTH, lanes[0]) :
+                 min_from(lanes, 1, Ops::WIDTH, lanes[0]);
+}
+
+template<typename Ops>
+__attribute__((target("sse4.2")))
+std::size_t find_sse42(const void* data, std::size_t n,
+                       typename Ops::T value) {
+    const char* bytes = static_cast<const char*>(data);
+    typename Ops::V target = Ops::set1(value);
+    std::size_t end = n - n % Ops::WIDTH;
+    for (std::size_t i = 0; i < end; i += Ops::WIDTH) {
+        unsigned mask = Ops::eq(Ops::load(bytes + i * sizeof(value)), target);
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return end;
+}
+
+template<typename Ops>
+__attribute__((target("sse4.2")))
+std::size_t count_sse42(const void* data, std::size_t n,
+                        typename Ops::T value) {
+    const char* bytes = static_cast<const char*>(data);
+    typename Ops::V target = Ops::set1(value);
+    std::size_t end = n - n % Ops::WIDTH;
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < end; i += Ops::WIDTH) {
+        unsigned mask = Ops::eq(Ops::load(bytes + i * sizeof(value)), target);
+        result += __builtin_popcount(mask);
+    }
+    return result;
+}
+
+template<typename Ops, bool Max>
+__attribute__((target("sse4.2")))
+typename Ops::T extreme_sse42(const typename Ops::T* data, std::size_t n) {
+    typename Ops::V best = Ops::load(data);
+    std::size_t end = n - n % Ops::WIDTH;
+    for (std::size_t i = Ops::WIDTH; i < end; i += Ops::WIDTH) {
+        typename Ops::V v = Ops::load(data + i);
+        best = Max ? Ops::max(best, v) : Ops::min(best, v);
+    }
+    typename Ops::T lanes[Ops::WIDTH];
+    Ops::store(lanes, best);
+    return Max ? max_from(lanes, 1, Ops::WIDTH, lanes[0]) :
+                 min_from(lanes, 1, Ops::WIDTH, lanes[0]);
+}
+
+#undef STRUCTURES_AVX2
+#undef STRUCTURES_SSE42
+
+/// Escolhe o núcleo e completa com o laço comum
+template<typename Avx2, typename Sse42, typename T>
+std::size_t find(const T* data, std::size_t n, const T& value,
+                 typename Avx2::T key) {
+    std::size_t done = 0;
+    if (level() == Level::AVX2) {
+        done = find_avx2<Avx2>(data, n, key);
+        if (done < n - n % Avx2::WIDTH) {
+            return done;
+        }
+    } else if (level() == Level::SSE42) {
+        done = find_sse42<Sse42>(data, n, key);
+        if (done < n - n % Sse42::WIDTH) {
+            return done;
+        }
+    }
+    return find_from(data, done, n, value);
+}
+
+template<typename Avx2, typename Sse42, typename T>
+std::size_t count(const T* data, std::size_t n, const T& value,
+                  typename Avx2::T key) {
+    std::size_t done = 0;
+    std::size_t result = 0;
+    if (level() == Level::AVX2) {
+        result = count_avx2<Avx2>(data, n, key);
+        done = n - n % Avx2::WIDTH;
+    } else if (level() == Level::SSE42) {
+        result = count_sse42<Sse42>(data, n, key);
+        done = n - n % Sse42::WIDTH;
+    }
+    return result + count_from(data, done, n, value);
+}
+
+template<typename Avx2, typename Sse42, bool Max, typename T>
+T extreme(const T* data, std::size_t n) {
+    std::size_t done = 1;
+    T best = data[0];
+    if (level() == Level::AVX2 && n >= Avx2::WIDTH) {
+        best = extreme_avx2<Avx2, Max>(data, n);
+        done = n - n % Avx2::WIDTH;
+    } else if (level() == Level::SSE42 && n >= Sse42::WIDTH) {
+        best = extreme_sse42<Sse42, Max>(data, n);
+        done = n - n % Sse42::WIDTH;
+    }
+    return Max ? max_from(data, done, n, best) :
+                 min_from(data, done, n, best);
+}
+
+#endif  // STRUCTURES_SIMD_X86
+
+}  // namespace detail
+
+}  // namespace simd
+}  // namespace structures
+
+template<typename T>
+std::size_t structures::simd::find(const T* data, std::size_t n,
+                                   const T& value) {
+    return detail::find_from(data, 0, n, value);
+}
+
+template<typename T>
+std::size_t structures::simd::count(const T* data, std::size_t n,
+                                    const T& value) {
+    return detail::count_from(data, 0, n, value);
+}
+
+template<typename T>
+T structures::simd::min(const T* data, std::size_t n) {
+    return detail::min_from(data, 1, n, data[0]);
+}
+
+template<typename T>
+T structures::simd::max(const T* data, std::size_t n) {
+    return detail::max_from(data, 1, n, data[0]);
+}
+
+template<typename U>
+std::size_t structures::simd::find(U* const* data, std::size_t n,
+                                   U* const& value) {
+#if STRUCTURES_SIMD_X86
+    if (sizeof(U*) == sizeof(long long)) {
+        return detail::find<detail::Avx2Int64, detail::Sse42Int64>(
+            data, n, value, reinterpret_cast<std::uintptr_t>(value));
+    }
+#endif
+    return detail::find_from(data, 0, n, value);
+}
+
+template<typename U>
+std::size_t structures::simd::count(U* const* data, std::size_t n,
+                                    U* const& value) {
+#if STRUCTURES_SIMD_X86
+    if (sizeof(U*) == sizeof(long long)) {
+        return detail::count<detail::Avx2Int64, detail::Sse42Int64>(
+            data, n, value, reinterpret_cast<std::uintptr_t>(value));
+    }
+#endif
+    return detail::count_from(data, 0, n, value);
+}
+
+#if STRUCTURES_SIMD_X86
+
+inline std::size_t structures::simd::find(const int* data, std::size_t n,
+                                          const int& value) {
+    return detail::find<detail::Avx2Int32, detail::Sse42Int32>(
+        data, n, value, value);
+}
+
+inline std::size_t structures::simd::count(const int* data, std::size_t n,
+                                           const int& value) {
+    return detail::count<detail::Avx2Int32, detail::Sse42Int32>(
+        data, n, value, value);
+}
+
+inline int structures::simd::min(const int* data, std::size_t n) {
+    return detail::extreme<detail::Avx2Int32, detail::Sse42Int32, false>(
+        data, n);
+}
+
+inline int structures::simd::max(const int* data, std::size_t n) {
+    return detail::extreme<detail::Avx2Int32, detail::Sse42Int32, true>(
+        data, n);
+}
+
+inline std::size_t structures::simd::find(const float* data, std::size_t n,
+                                          const float& value) {
+    return detail::find<detail::Avx2Float, detail::Sse42Float>(
+        data, n, value, value);
+}
+
+inline std::size_t structures::simd::count(const float* data, std::size_t n,
+                                           const float& value) {
+    return detail::count<detail::Avx2Float, detail::Sse42Float>(
+        data, n, value, value);
+}
+
+inline float structures::simd::min(const float* data, std::size_t n) {
+    return detail::extreme<detail::Avx2Float, detail::Sse42Float, false>(
+        data, n);
+}
+
+inline float structures::simd::max(const float* data, std::size_t n) {
+    return detail::extreme<detail::Avx2Float, detail::Sse42Float, true>(
+        data, n);
+}
+
+inline std::size_t structures::simd::find(const double* data, std::size_t n,
+                                          const double& value) {
+    return detail::find<detail::Avx2Double, detail::Sse42Double>(
+        data, n, value, value);
+}
+
+inline std::size_t structures::simd::count(const double* data,
+                                           std::size_t n,
+                                           const double& value) {
+    return detail::count<detail::Avx2Double, detail::Sse42Double>(
+        data, n, value, value);
+}
+
+inline double structures::simd::min(const double* data, std::size_t n) {
+    return detail::extreme<detail::Avx2Double, detail::Sse42Double, false>(
+        data, n);
+}
+
+inline double structures::simd::max(const double* data, std::size_t n) {
+    return detail::extreme<detail::Avx2Double, detail::Sse42Double, true>(
+        data, n);
+}
+
+#else
+
+inline std::size_t structures::simd::find(const int* data, std::size_t n,
+                                          const int& value) {
+    return detail::find_from(data, 0, n, value);
+}
+
+inline std::size_t structures::simd::count(const int* data, std::size_t n,
+                                           const int& value) {
+    return detail::count_from(data, 0, n, value);
+}
+
+inline int structures::simd::min(const int* data, std::size_t n) {
+    return detail::min_from(data, 1, n, data[0]);
+}
+
+inline int structures::simd::max(const int* data, std::size_t n) {
+    return detail::max_from(data, 1, n, data[0]);
+}
+
+inline std::size_t structures::simd::find(const float* data, std::size_t n,
+                                          const float& value) {
+    return detail::find_from(data, 0, n, value);
+}
+
+inline std::size_t structures::simd::count(const float* data, std::size_t n,
+                                           const float& value) {
+    return detail::count_from(data, 0, n, value);
+}
+
+inline float structures::simd::min(const float* data, std::size_t n) {
+    return detail::min_from(data, 1, n, data[0]);
+}
+
+inline float structures::simd::max(const float* data, std::size_t n) {
+    return detail::max_from(data, 1, n, data[0]);
+}
+
+inline std::size_t structures::simd::find(const double* data, std::size_t n,
+                                          const double& value) {
+    return detail::find_from(data, 0, n, value);
+}
+
+inline std::size_t structures::simd::count(const double* data,
+                                           std::size_t n,
+                                           const double& value) {
+    return detail::count_from(data, 0, n, value);
+}
+
+inline double structures::simd::min(const double* data, std::size_t n) {
+    return detail::min_from(data, 1, n, data[0]);
+}
+
+inline double structures::simd::max(const double* data, std::size_t n) {
+    return detail::max_from(data, 1, n, data[0]);
+}
+
+#endif  // STRUCTURES_SIMD_X86
+
+#endif
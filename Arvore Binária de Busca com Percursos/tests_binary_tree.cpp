@@ -0,0 +1,158 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_binary_tree.cpp
+
+#include "gtest/gtest.h"
+#include "binary_tree.h"
+#include "binary_tree.h"
+#include "../tests_memory_resource.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#if __cplusplus >= 202002L
+// Os iteradores satisfazem o conceito de std::ranges esperado.
+static_assert(std::ranges::bidirectional_range<structures::BinaryTree<int>>);
+static_assert(std::ranges::bidirectional_range<
+    const structures::BinaryTree<int>>);
+static_assert(!std::ranges::random_access_range<structures::BinaryTree<int>>);
+#endif
+
+namespace {
+
+template<typename T>
+std::vector<T> to_vector(const structures::ArrayList<T>& list) {
+    std::vector<T> result;
+    for (std::size_t i = 0; i < list.size(); ++i) {
+        result.push_back(list.at(i));
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(BinaryTreeIteratorTest, EmptyTree) {
+    structures::BinaryTree<int> tree;
+    ASSERT_TRUE(tree.begin() == tree.end());
+    ASSERT_TRUE(--tree.end() == tree.end());
+}
+
+TEST(BinaryTreeIteratorTest, RangeForMatchesInOrder) {
+    structures::BinaryTree<int> tree;
+    std::srand(22);
+    for (auto i = 0; i < 300; ++i) {
+        auto value = std::rand() % 1000;
+        if (!tree.contains(value)) {
+            tree.insert(value);
+        }
+    }
+    std::vector<int> visited;
+    for (auto value : tree) {
+        visited.push_back(value);
+    }
+    ASSERT_EQ(to_vector(tree.in_order()), visited);
+    ASSERT_EQ(tree.size(), visited.size());
+    ASSERT_TRUE(std::is_sorted(visited.begin(), visited.end()));
+}
+
+TEST(BinaryTreeIteratorTest, DecrementFromEnd) {
+    structures::BinaryTree<int> tree;
+    for (auto value : {50, 30, 70, 20, 40, 60, 80, 35, 65}) {
+        tree.insert(value);
+    }
+    ASSERT_EQ(80, *--tree.end());
+    std::vector<int> backwards;
+    auto it = tree.end();
+    while (it != tree.begin()) {
+        backwards.push_back(*--it);
+    }
+    ASSERT_EQ((std::vector<int>{80, 70, 65, 60, 50, 40, 35, 30, 20}),
+              backwards);
+    ++it;
+    --it;
+    ASSERT_EQ(20, *it);
+}
+
+TEST(BinaryTreeIteratorTest, StandardAlgorithms) {
+    structures::BinaryTree<int> tree;
+    for (auto value : {8, 3, 10, 1, 6, 14, 4, 7, 13}) {
+        tree.insert(value);
+    }
+    ASSERT_EQ(9, std::distance(tree.begin(), tree.end()));
+    auto it = std::find(tree.begin(), tree.end(), 6);
+    ASSERT_EQ(4, *std::prev(it));
+    ASSERT_EQ(7, *std::next(it));
+    ASSERT_EQ(6, *std::lower_bound(tree.begin(), tree.end(), 5));
+    ASSERT_EQ(3, std::count_if(tree.begin(), tree.end(),
+                               [](int x) { return x > 8; }));
+    std::vector<int> reversed(
+        std::reverse_iterator<structures::BinaryTree<int>::iterator>(
+            tree.end()),
+        std::reverse_iterator<structures::BinaryTree<int>::iterator>(
+            tree.begin()));
+    ASSERT_EQ((std::vector<int>{14, 13, 10, 8, 7, 6, 4, 3, 1}), reversed);
+    tree.remove(8);
+    ASSERT_TRUE(std::find(tree.begin(), tree.end(), 8) == tree.end());
+    ASSERT_EQ(8, std::distance(tree.begin(), tree.end()));
+}
+
+TEST(BinaryTreeTest, RandomInsertAndRemove) {
+    structures::BinaryTree<int> tree;
+    std::set<int> expected;
+    std::srand(25);
+    for (auto i = 0; i < 2000; ++i) {
+        auto value = std::rand() % 200;
+        if (expected.count(value) == 0) {
+            tree.insert(value);
+            expected.insert(value);
+        } else {
+            // Inclusive a raiz, com zero, um ou dois filhos.
+            tree.remove(value);
+            expected.erase(value);
+        }
+        ASSERT_EQ(expected.size(), tree.size());
+    }
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), tree.begin()));
+    ASSERT_EQ(expected.size(), tree.in_order().size());
+    for (auto value : expected) {
+        tree.remove(value);
+    }
+    ASSERT_TRUE(tree.empty());
+    ASSERT_TRUE(tree.begin() == tree.end());
+    ASSERT_THROW(tree.remove(1), std::out_of_range);
+}
+
+#if __cplusplus >= 201703L
+TEST(BinaryTreeAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::BinaryTree<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.insert(std::move(value));
+        },
+        [](C& tree, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_TRUE(tree.contains(tests::long_value(i)));
+            }
+            auto in_order = tree.in_order();
+            for (std::size_t i = 1; i < in_order.size(); ++i) {
+                ASSERT_LT(in_order.at(i - 1), in_order.at(i));
+            }
+        });
+}
+#endif
@@ -0,0 +1,324 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_ARRAY_DEQUE_H
+#define STRUCTURES_ARRAY_DEQUE_H
+
+#include <cstdint>  /// std::size_t
+#include <cstring>  /// std::memcpy
+#include <memory>  /// std::allocator
+#include <new>  /// placement new
+#include <stdexcept>  /// C++ Exceptions
+#include <type_traits>  /// std::is_trivially_copyable
+#include <utility>  /// std::move, std::forward
+
+namespace structures {
+
+template<typename T>
+/// classe ArrayDeque: fila dupla circular em vetor que cresce ao encher
+class ArrayDeque {
+ public:
+    /// construtor padrao
+    ArrayDeque();
+    /// construtor com capacidade inicial
+    explicit ArrayDeque(std::size_t max);
+    /// destrutor padrao
+    ~ArrayDeque();
+    /// copia nao suportada
+    ArrayDeque(const ArrayDeque&) = delete;
+    /// atribuicao nao suportada
+    ArrayDeque& operator=(const ArrayDeque&) = delete;
+    /// construtor por movimento: rouba o vetor; other fica vazia e sem vetor
+    ArrayDeque(ArrayDeque&& other) noexcept;
+    /// atribuicao por movimento: rouba o vetor; other fica vazia e sem vetor
+    ArrayDeque& operator=(ArrayDeque&& other) noexcept;
+    /// metodo insere no fim
+    void push_back(const T& data);
+    /// metodo insere no fim movendo o dado
+    void push_back(T&& data);
+    /// metodo insere no inicio
+    void push_front(const T& data);
+    /// metodo insere no inicio movendo o dado
+    void push_front(T&& data);
+    /// metodo constroi o dado no fim
+    template<typename... Args>
+    T& emplace_back(Args&&... args);
+    /// metodo constroi o dado no inicio
+    template<typename... Args>
+    T& emplace_front(Args&&... args);
+    /// metodo retira do fim
+    T pop_back();
+    /// metodo retira do inicio
+    T pop_front();
+    /// metodo retorna o primeiro
+    T& front();
+    /// metodo retorna o ultimo
+    T& back();
+    /// metodo acessa a posicao (checando limites)
+    T& at(std::size_t index);
+    /// metodo acessa a posicao
+    T& operator[](std::size_t index);
+    /// metodo limpa a fila
+    void clear();
+    /// metodo garante capacidade para ao menos n elementos
+    void reserve(std::size_t n);
+    /// metodo retorna tamanho atual
+    std::size_t size() const;
+    /// metodo retorna capacidade atual
+    std::size_t max_size() const;
+    /// metodo verifica se vazio
+    bool empty() const;
+
+ private:
+    /// posicao fisica da posicao logica index
+    std::size_t wrap(std::size_t index) const {
+        return (begin_ + index) & (max_size_ - 1);
+    }
+    /// realoca desenrolando o anel: o inicio passa para a posicao 0
+    void reallocate(std::size_t new_size);
+    /// capacidade depois de crescer (fila movida nao tem vetor)
+    std::size_t grown_size() const {
+        return (max_size_ == 0) ? DEFAULT_SIZE : max_size_ * GROWTH_FACTOR;
+    }
+    /// libera o vetor, se houver
+    void deallocate();
+    /// toma o vetor de other, deixando-a vazia e sem vetor
+    void steal(ArrayDeque& other) noexcept;
+
+    T* contents;
+    std::size_t max_size_;  /// sempre potencia de 2
+    std::size_t begin_{0};  /// indice fisico do inicio
+    std::size_t size_{0};
+
+    static const auto DEFAULT_SIZE = 16u;
+    static const auto GROWTH_FACTOR = 2u;
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::ArrayDeque<T>::ArrayDeque():
+    ArrayDeque(DEFAULT_SIZE)
+{}
+
+template<typename T>
+structures::ArrayDeque<T>::ArrayDeque(std::size_t max) {
+    max_size_ = 1;
+    while (max_size_ < max) {
+        max_size_ *= 2;
+    }
+    contents = std::allocator<T>().allocate(max_size_);
+}
+
+template<typename T>
+structures::ArrayDeque<T>::ArrayDeque(ArrayDeque&& other) noexcept {
+    steal(other);
+}
+
+template<typename T>
+structures::ArrayDeque<T>::~ArrayDeque() {
+    clear();
+    deallocate();
+}
+
+template<typename T>
+structures::ArrayDeque<T>&
+structures::ArrayDeque<T>::operator=(ArrayDeque&& other) noexcept {
+    if (this != &other) {
+        clear();
+        deallocate();
+        steal(other);
+    }
+    return *this;
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::push_back(const T& data) {
+    emplace_back(data);
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::push_back(T&& data) {
+    emplace_back(std::move(data));
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::push_front(const T& data) {
+    emplace_front(data);
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::push_front(T&& data) {
+    emplace_front(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+T& structures::ArrayDeque<T>::emplace_back(Args&&... args) {
+    if (size_ == max_size_) {
+        // Constroi antes de crescer: args pode referenciar a propria fila.
+        T value(std::forward<Args>(args)...);
+        reallocate(grown_size());
+        return emplace_back(std::move(value));
+    }
+    T* slot = new (contents + wrap(size_)) T(std::forward<Args>(args)...);
+    size_++;
+    return *slot;
+}
+
+template<typename T>
+template<typename... Args>
+T& structures::ArrayDeque<T>::emplace_front(Args&&... args) {
+    if (size_ == max_size_) {
+        T value(std::forward<Args>(args)...);
+        reallocate(grown_size());
+        return emplace_front(std::move(value));
+    }
+    std::size_t position = wrap(max_size_ - 1);
+    T* slot = new (contents + position) T(std::forward<Args>(args)...);
+    begin_ = position;
+    size_++;
+    return *slot;
+}
+
+template<typename T>
+T structures::ArrayDeque<T>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        T* slot = contents + wrap(size_ - 1);
+        T data = std::move(*slot);
+        slot->~T();
+        size_--;
+        return data;
+    }
+}
+
+template<typename T>
+T structures::ArrayDeque<T>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        T* slot = contents + begin_;
+        T data = std::move(*slot);
+        slot->~T();
+        begin_ = wrap(1);
+        size_--;
+        return data;
+    }
+}
+
+template<typename T>
+T& structures::ArrayDeque<T>::front() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        return contents[begin_];
+    }
+}
+
+template<typename T>
+T& structures::ArrayDeque<T>::back() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        return contents[wrap(size_ - 1)];
+    }
+}
+
+template<typename T>
+T& structures::ArrayDeque<T>::at(std::size_t index) {
+    if (index >= size_) {
+        throw std::out_of_range("posicao invalida");
+    } else {
+        return contents[wrap(index)];
+    }
+}
+
+template<typename T>
+T& structures::ArrayDeque<T>::operator[](std::size_t index) {
+    return contents[wrap(index)];
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::clear() {
+    for (std::size_t i = 0; i < size_; i++) {
+        contents[wrap(i)].~T();
+    }
+    begin_ = 0;
+    size_ = 0;
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::reserve(std::size_t n) {
+    std::size_t new_size = (max_size_ == 0) ? 1 : max_size_;
+    while (new_size < n) {
+        new_size *= GROWTH_FACTOR;
+    }
+    if (new_size != max_size_) {
+        reallocate(new_size);
+    }
+}
+
+template<typename T>
+std::size_t structures::ArrayDeque<T>::size() const {
+    return size_;
+}
+
+template<typename T>
+std::size_t structures::ArrayDeque<T>::max_size() const {
+    return max_size_;
+}
+
+template<typename T>
+bool structures::ArrayDeque<T>::empty() const {
+    return (size_ == 0);
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::reallocate(std::size_t new_size) {
+    T* new_contents = std::allocator<T>().allocate(new_size);
+    // O anel ocupa [begin_, fim do vetor) seguido de [0, resto).
+    std::size_t first = max_size_ - begin_;
+    if (first > size_) {
+        first = size_;
+    }
+    // Fila movida pode ter contents nulo: so copia se houver dados.
+    if (std::is_trivially_copyable<T>::value && size_ > 0) {
+        std::memcpy(static_cast<void*>(new_contents),
+                    static_cast<const void*>(contents + begin_),
+                    first * sizeof(T));
+        std::memcpy(static_cast<void*>(new_contents + first),
+                    static_cast<const void*>(contents),
+                    (size_ - first) * sizeof(T));
+    } else {
+        for (std::size_t i = 0; i < size_; i++) {
+            T* old = contents + wrap(i);
+            new (new_contents + i) T(std::move(*old));
+            old->~T();
+        }
+    }
+    deallocate();
+    contents = new_contents;
+    max_size_ = new_size;
+    begin_ = 0;
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::deallocate() {
+    if (contents != nullptr) {
+        std::allocator<T>().deallocate(contents, max_size_);
+    }
+}
+
+template<typename T>
+void structures::ArrayDeque<T>::steal(ArrayDeque& other) noexcept {
+    contents = other.contents;
+    max_size_ = other.max_size_;
+    begin_ = other.begin_;
+    size_ = other.size_;
+    other.contents = nullptr;
+    other.max_size_ = 0;
+    other.begin_ = 0;
+    other.size_ = 0;
+}
+
+#endif
@@ -2,27 +2,79 @@
 #ifndef STRUCTURES_ARRAY_QUEUE_H
 #define STRUCTURES_ARRAY_QUEUE_H
 
+#include <algorithm>  /// std::min, std::move
 #include <cstdint>  /// std::size_t
+#include <iterator>  /// std::make_move_iterator
+#include <memory>  /// std::allocator_traits, std::uninitialized_copy
+#include <new>  /// placement new
 #include <stdexcept>  /// C++ Exceptions
+#include <type_traits>  /// std::true_type, std::false_type
+#include <utility>  /// std::move, std::forward, std::swap
+#if __cplusplus >= 201703L
+#include <memory_resource>  /// std::pmr::polymorphic_allocator
+#endif
 
 namespace structures {
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 /// classe ArrayQueue
 class ArrayQueue {
  public:
+    using allocator_type = Allocator;
+
+    /// trecho contiguo de elementos
+    struct Span {
+        T* data;
+        std::size_t size;
+    };
+    /// elementos da fila em ate dois trechos contiguos, na ordem
+    struct Spans {
+        Span first;
+        Span second;
+    };
+
     /// construtor padrao
     ArrayQueue();
-    /// construtor com parametro
-    explicit ArrayQueue(std::size_t max);
+    /// construtor com parametro e alocador
+    explicit ArrayQueue(std::size_t max,
+                        const Allocator& allocator = Allocator());
+    /// construtor com alocador
+    explicit ArrayQueue(const Allocator& allocator);
+    /// construtor de copia: uma alocacao e a copia dos dois trechos
+    ArrayQueue(const ArrayQueue& other);
+    /// construtor de copia alocando com allocator
+    ArrayQueue(const ArrayQueue& other, const Allocator& allocator);
+    /// construtor de movimento: toma o vetor de other em O(1)
+    ArrayQueue(ArrayQueue&& other) noexcept;
     /// destrutor padrao
     ~ArrayQueue();
+    /// atribuicao por copia; o alocador de cada fila nao muda
+    ArrayQueue& operator=(const ArrayQueue& other);
+    /// atribuicao por movimento: O(1) se o vetor puder trocar de dono
+    ArrayQueue& operator=(ArrayQueue&& other);
+    /// troca o conteudo com other em O(1)
+    void swap(ArrayQueue& other) noexcept;
+    /// metodo retorna o alocador
+    Allocator get_allocator() const;
     /// metodo enfileirar
     void enqueue(const T& data);
+    /// metodo enfileirar movendo o dado
+    void enqueue(T&& data);
+    /// metodo enfileirar construindo o dado no lugar
+    template<typename... Args>
+    T& emplace(Args&&... args);
     /// metodo desenfileirar
     T dequeue();
     /// metodo retorna o ultimo
     T& back();
+    /// metodo enfileira ate n dados; retorna quantos couberam
+    std::size_t enqueue_bulk(const T* data, std::size_t n);
+    /// metodo desenfileira ate n dados em out; retorna quantos sairam
+    std::size_t dequeue_bulk(T* out, std::size_t n);
+    /// metodo expoe os elementos da fila sem copia-los
+    Spans peek_spans();
+    /// metodo descarta os n primeiros elementos
+    void consume(std::size_t n);
     /// metodo limpa a fila
     void clear();
     /// metodo retorna tamanho atual
@@ -35,7 +87,24 @@ class ArrayQueue {
     bool full();
 
  private:
-    T* contents;
+    /// aloca memoria sem construir elementos
+    T* allocate(std::size_t n);
+    /// libera memoria alocada por allocate
+    void deallocate(T* p, std::size_t n);
+    /// toma o vetor de other, que fica vazia e sem capacidade
+    void steal(ArrayQueue& other) noexcept;
+    /// movimento quando o alocador acompanha o vetor
+    void move_assign(ArrayQueue& other, std::true_type);
+    /// movimento quando o alocador fica: so toma o vetor se for igual
+    void move_assign(ArrayQueue& other, std::false_type);
+    /// troca os alocadores, se eles acompanham a troca
+    void swap_allocator(ArrayQueue& other, std::true_type) noexcept;
+    void swap_allocator(ArrayQueue& other, std::false_type) noexcept;
+
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    Allocator allocator_;
+    T* contents;  /// apenas os size_ elementos a partir de begin_ sao validos
     std::size_t size_;
     std::size_t max_size_;
     int begin_;  ///indice do inicio (para fila circular)
@@ -43,59 +112,169 @@ class ArrayQueue {
     static const auto DEFAULT_SIZE = 10u;
 };
 
-}  // namespace structures
-
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Fila que aloca de um std::pmr::memory_resource
+template<typename T>
+using ArrayQueue =
+    structures::ArrayQueue<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 #endif
 
+}  // namespace structures
 
-template<typename T>
-structures::ArrayQueue<T>::ArrayQueue() {
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue() {
     max_size_ = DEFAULT_SIZE;
-    contents = new T[max_size_];
+    contents = allocate(max_size_);
     begin_ = 0;
     end_ = -1;
     size_ = 0;
 }
 
-template<typename T>
-structures::ArrayQueue<T>::ArrayQueue(std::size_t max) {
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue(std::size_t max,
+                                                 const Allocator& allocator):
+    allocator_{allocator} {
     max_size_ = max;
-    contents = new T[max_size_];
+    contents = allocate(max_size_);
     begin_ = 0;
     end_ = -1;
     size_ = 0;
 }
 
-template<typename T>
-structures::ArrayQueue<T>::~ArrayQueue() {
-    delete [] contents;
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue(const Allocator& allocator):
+    allocator_{allocator} {
+    max_size_ = DEFAULT_SIZE;
+    contents = allocate(max_size_);
+    begin_ = 0;
+    end_ = -1;
+    size_ = 0;
 }
 
-template<typename T>
-void structures::ArrayQueue<T>::enqueue(const T& data) {
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue(const ArrayQueue& other):
+    ArrayQueue(other,
+               AllocatorTraits::select_on_container_copy_construction(
+                   other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue(const ArrayQueue& other,
+                                                 const Allocator& allocator):
+    allocator_{allocator} {
+    max_size_ = other.max_size_;
+    contents = allocate(max_size_);
+    // A copia fica linear, a partir da posicao 0.
+    std::size_t first = std::min(other.size_, max_size_ - other.begin_);
+    T* middle = contents;
+    try {
+        middle = std::uninitialized_copy(other.contents + other.begin_,
+                                         other.contents + other.begin_ + first,
+                                         contents);
+        std::uninitialized_copy(other.contents,
+                                other.contents + (other.size_ - first),
+                                middle);
+    } catch (...) {
+        for (T* p = contents; p != middle; ++p) {
+            p->~T();
+        }
+        deallocate(contents, max_size_);
+        throw;
+    }
+    size_ = other.size_;
+    begin_ = 0;
+    end_ = static_cast<int>(size_) - 1;
+}
+
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::ArrayQueue(ArrayQueue&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>::~ArrayQueue() {
+    clear();
+    deallocate(contents, max_size_);
+}
+
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>&
+structures::ArrayQueue<T, Allocator>::operator=(const ArrayQueue& other) {
+    if (this != &other) {
+        ArrayQueue copy(other, allocator_);
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::ArrayQueue<T, Allocator>&
+structures::ArrayQueue<T, Allocator>::operator=(ArrayQueue&& other) {
+    if (this != &other) {
+        move_assign(other, typename AllocatorTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::swap(ArrayQueue& other) noexcept {
+    std::swap(contents, other.contents);
+    std::swap(size_, other.size_);
+    std::swap(max_size_, other.max_size_);
+    std::swap(begin_, other.begin_);
+    std::swap(end_, other.end_);
+    swap_allocator(other,
+                   typename AllocatorTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::ArrayQueue<T, Allocator>::get_allocator() const {
+    return allocator_;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::enqueue(const T& data) {
+    emplace(data);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::enqueue(T&& data) {
+    emplace(std::move(data));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+T& structures::ArrayQueue<T, Allocator>::emplace(Args&&... args) {
     if (full()) {
         throw std::out_of_range("fila cheia");
     } else {
-        end_ = (end_ + 1) % max_size_;
-        contents[end_] = data;
+        int position = (end_ + 1) % max_size_;
+        T* slot = new (contents + position) T(std::forward<Args>(args)...);
+        end_ = position;
         size_++;
+        return *slot;
     }
 }
 
-template<typename T>
-T structures::ArrayQueue<T>::dequeue() {
+template<typename T, typename Allocator>
+T structures::ArrayQueue<T, Allocator>::dequeue() {
     if (empty()) {
         throw std::out_of_range("fila vazia");
     } else {
-        T data = contents[begin_];
+        T data = std::move(contents[begin_]);
+        contents[begin_].~T();
         begin_ = (begin_ + 1) % max_size_;
         size_--;
         return data;
     }
 }
 
-template<typename T>
-T& structures::ArrayQueue<T>::back() {
+template<typename T, typename Allocator>
+T& structures::ArrayQueue<T, Allocator>::back() {
     if (empty()) {
         throw std::out_of_range("fila vazia");
     } else {
@@ -103,29 +282,197 @@ T& structures::ArrayQueue<T>::back() {
     }
 }
 
-template<typename T>
-void structures::ArrayQueue<T>::clear() {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayQueue<T, Allocator>::enqueue_bulk(const T* data,
+                                                    std::size_t n) {
+    std::size_t count = std::min(n, max_size_ - size_);
+    if (count == 0) {
+        return 0;
+    }
+    // Indices voltam ao inicio por comparacao: count <= max_size_, e o
+    // modulo custaria uma divisao por rajada.
+    std::size_t start = static_cast<std::size_t>(end_ + 1);
+    if (start == max_size_) {
+        start = 0;
+    }
+    std::size_t first = std::min(count, max_size_ - start);
+    std::uninitialized_copy(data, data + first, contents + start);
+    if (first < count) {
+        try {
+            std::uninitialized_copy(data + first, data + count, contents);
+        } catch (...) {
+            // O segundo trecho ja se desfez; desfaz o primeiro.
+            for (std::size_t i = 0; i < first; i++) {
+                contents[start + i].~T();
+            }
+            throw;
+        }
+    }
+    std::size_t last = start + count - 1;
+    if (last >= max_size_) {
+        last -= max_size_;
+    }
+    end_ = static_cast<int>(last);
+    size_ += count;
+    return count;
+}
+
+template<typename T, typename Allocator>
+std::size_t structures::ArrayQueue<T, Allocator>::dequeue_bulk(T* out,
+                                                               std::size_t n) {
+    std::size_t count = std::min(n, size_);
+    Spans spans = peek_spans();
+    std::size_t first = std::min(count, spans.first.size);
+    std::move(spans.first.data, spans.first.data + first, out);
+    if (first < count) {
+        std::move(spans.second.data, spans.second.data + (count - first),
+                  out + first);
+    }
+    consume(count);
+    return count;
+}
+
+template<typename T, typename Allocator>
+typename structures::ArrayQueue<T, Allocator>::Spans
+structures::ArrayQueue<T, Allocator>::peek_spans() {
+    std::size_t first = std::min(size_, max_size_ - begin_);
+    return {{contents + begin_, first}, {contents, size_ - first}};
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::consume(std::size_t n) {
+    if (n > size_) {
+        throw std::out_of_range("fila vazia");
+    }
+    if (n == 0) {
+        return;
+    }
+    Spans spans = peek_spans();
+    std::size_t first = std::min(n, spans.first.size);
+    for (std::size_t i = 0; i < first; i++) {
+        spans.first.data[i].~T();
+    }
+    for (std::size_t i = 0; i < n - first; i++) {
+        spans.second.data[i].~T();
+    }
+    std::size_t begin = begin_ + n;
+    if (begin >= max_size_) {
+        begin -= max_size_;
+    }
+    begin_ = static_cast<int>(begin);
+    size_ -= n;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::clear() {
+    while (size_ > 0) {
+        contents[begin_].~T();
+        begin_ = (begin_ + 1) % max_size_;
+        size_--;
+    }
     begin_ = 0;
     end_ = -1;
-    size_ = 0;
 }
 
-template<typename T>
-std::size_t structures::ArrayQueue<T>::size() {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayQueue<T, Allocator>::size() {
     return size_;
 }
 
-template<typename T>
-std::size_t structures::ArrayQueue<T>::max_size() {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayQueue<T, Allocator>::max_size() {
     return max_size_;
 }
 
-template<typename T>
-bool structures::ArrayQueue<T>::empty() {
+template<typename T, typename Allocator>
+bool structures::ArrayQueue<T, Allocator>::empty() {
     return (size_ == 0);
 }
 
-template<typename T>
-bool structures::ArrayQueue<T>::full() {
+template<typename T, typename Allocator>
+bool structures::ArrayQueue<T, Allocator>::full() {
     return (size_ == max_size_);
 }
+
+template<typename T, typename Allocator>
+T* structures::ArrayQueue<T, Allocator>::allocate(std::size_t n) {
+    return AllocatorTraits::allocate(allocator_, n);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::deallocate(T* p, std::size_t n) {
+    // fila movida nao tem vetor
+    if (p != nullptr) {
+        AllocatorTraits::deallocate(allocator_, p, n);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::steal(ArrayQueue& other) noexcept {
+    contents = other.contents;
+    size_ = other.size_;
+    max_size_ = other.max_size_;
+    begin_ = other.begin_;
+    end_ = other.end_;
+    other.contents = nullptr;
+    other.size_ = 0;
+    other.max_size_ = 0;
+    other.begin_ = 0;
+    other.end_ = -1;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::move_assign(ArrayQueue& other,
+                                                       std::true_type) {
+    clear();
+    deallocate(contents, max_size_);
+    allocator_ = std::move(other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::move_assign(ArrayQueue& other,
+                                                       std::false_type) {
+    clear();
+    deallocate(contents, max_size_);
+    contents = nullptr;
+    max_size_ = 0;
+    if (allocator_ == other.allocator_) {
+        steal(other);
+        return;
+    }
+    // o vetor de other nao pode ser liberado por este alocador
+    contents = allocate(other.max_size_);
+    max_size_ = other.max_size_;
+    Spans spans = other.peek_spans();
+    T* position = std::uninitialized_copy(
+        std::make_move_iterator(spans.first.data),
+        std::make_move_iterator(spans.first.data + spans.first.size),
+        contents);
+    try {
+        std::uninitialized_copy(
+            std::make_move_iterator(spans.second.data),
+            std::make_move_iterator(spans.second.data + spans.second.size),
+            position);
+    } catch (...) {
+        for (T* p = contents; p != position; ++p) {
+            p->~T();
+        }
+        throw;
+    }
+    size_ = other.size_;
+    end_ = static_cast<int>(size_) - 1;
+    other.clear();
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::swap_allocator(
+        ArrayQueue& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayQueue<T, Allocator>::swap_allocator(
+        ArrayQueue&, std::false_type) noexcept {}
+
+#endif
@@ -0,0 +1,89 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_array_queue_bulk.cpp
+///
+/// Custo por elemento de passar rajadas de 1, 16 e 256 ints pela
+/// ArrayQueue: um enqueue/dequeue por elemento, enqueue_bulk/dequeue_bulk,
+/// e enqueue_bulk com leitura no lugar por peek_spans/consume. A fila tem
+/// capacidade 1000 para que as rajadas deem a volta no vetor circular.
+///
+///     g++ -std=c++14 -O2 bench_array_queue_bulk.cpp -o bench
+#include "array_queue.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+/// Nanossegundos por elemento de f(queue, batch, in, out), que deve
+/// passar batch elementos pela fila, repetida até somar total elementos
+template<typename F>
+double per_element(std::size_t batch, std::size_t total, F f) {
+    structures::ArrayQueue<int> queue(1000);
+    std::vector<int> in(batch), out(batch);
+    for (std::size_t i = 0; i < batch; i++) {
+        in[i] = static_cast<int>(i);
+    }
+    std::size_t rounds = total / batch;
+    double elapsed = bench::seconds([&] {
+        long sum = 0;
+        for (std::size_t r = 0; r < rounds; r++) {
+            sum += f(queue, batch, in.data(), out.data());
+        }
+        bench::keep(sum);
+    });
+    return elapsed * 1e9 / (rounds * batch);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t total = bench::scaled(100000000, bench::scale(argc, argv));
+
+    std::printf("%6s %14s %14s %14s\n", "batch", "single ns/el",
+                "bulk ns/el", "spans ns/el");
+    for (std::size_t batch : {1u, 16u, 256u}) {
+        double single = per_element(batch, total, [](
+                structures::ArrayQueue<int>& queue, std::size_t n,
+                const int* in, int* out) {
+            for (std::size_t i = 0; i < n; i++) {
+                queue.enqueue(in[i]);
+            }
+            long sum = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                out[i] = queue.dequeue();
+                sum += out[i];
+            }
+            return sum;
+        });
+        double bulk = per_element(batch, total, [](
+                structures::ArrayQueue<int>& queue, std::size_t n,
+                const int* in, int* out) {
+            queue.enqueue_bulk(in, n);
+            n = queue.dequeue_bulk(out, n);
+            long sum = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                sum += out[i];
+            }
+            return sum;
+        });
+        double spans = per_element(batch, total, [](
+                structures::ArrayQueue<int>& queue, std::size_t n,
+                const int* in, int*) {
+            queue.enqueue_bulk(in, n);
+            auto readable = queue.peek_spans();
+            long sum = 0;
+            for (std::size_t i = 0; i < readable.first.size; i++) {
+                sum += readable.first.data[i];
+            }
+            for (std::size_t i = 0; i < readable.second.size; i++) {
+                sum += readable.second.data[i];
+            }
+            queue.consume(readable.first.size + readable.second.size);
+            return sum;
+        });
+        std::printf("%6zu %14.2f %14.2f %14.2f\n", batch, single, bulk,
+                    spans);
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_mpmc_array_queue.cpp
+///
+/// Vazão da MpmcArrayQueue com 1 a 64 threads, cada uma produzindo e
+/// consumindo em pares, contra a ArrayQueue protegida por std::mutex.
+///
+///     g++ -std=c++14 -O2 -pthread bench_mpmc_array_queue.cpp -o bench
+#include "array_queue.h"
+#include "mpmc_array_queue.h"
+#include "../benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+const std::size_t CAPACITY = 1024;
+
+/// ArrayQueue com um mutex em volta
+class LockedQueue {
+ public:
+    LockedQueue(): queue(CAPACITY) {}
+    bool try_enqueue(long data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.full()) {
+            return false;
+        }
+        queue.enqueue(data);
+        return true;
+    }
+    bool try_dequeue(long& data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.empty()) {
+            return false;
+        }
+        data = queue.dequeue();
+        return true;
+    }
+
+ private:
+    std::mutex mutex;
+    structures::ArrayQueue<long> queue;
+};
+
+/// Milhões de operações por segundo com threads threads, cada uma
+/// enfileirando e desenfileirando pairs vezes; como cada thread enfileira
+/// antes de desenfileirar, ninguém espera para sempre
+template<typename Queue>
+double throughput(unsigned threads, std::size_t pairs) {
+    Queue queue;
+    double elapsed = bench::run_threads(threads, [&](unsigned id) {
+        long sum = 0, data = 0;
+        for (std::size_t i = 0; i < pairs; i++) {
+            while (!queue.try_enqueue(static_cast<long>(id + i))) {
+                std::this_thread::yield();
+            }
+            while (!queue.try_dequeue(data)) {
+                std::this_thread::yield();
+            }
+            sum += data;
+        }
+        bench::keep(sum);
+    });
+    return 2.0 * threads * pairs / elapsed / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t total = bench::scaled(20000000, bench::scale(argc, argv));
+
+    std::printf("%8s %14s %14s\n", "threads", "mpmc Mops/s", "mutex Mops/s");
+    for (auto threads : bench::thread_counts(64)) {
+        std::size_t pairs = std::max<std::size_t>(total / threads, 1);
+        double mpmc =
+            throughput<structures::MpmcArrayQueue<long>>(threads, pairs);
+        double locked = throughput<LockedQueue>(threads, pairs);
+        std::printf("%8u %14.1f %14.1f\n", threads, mpmc, locked);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_spsc_array_queue.cpp
+///
+/// Vazão da SpscArrayQueue com uma thread produtora e uma consumidora,
+/// contra a ArrayQueue protegida por std::mutex. A linha "1 thread" enche
+/// e esvazia a fila na mesma thread, sem disputa pelas linhas de cache.
+///
+///     g++ -std=c++14 -O2 -pthread bench_spsc_array_queue.cpp -o bench
+#include "array_queue.h"
+#include "spsc_array_queue.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+const std::size_t CAPACITY = 4096;
+
+/// ArrayQueue com um mutex em volta
+class LockedQueue {
+ public:
+    LockedQueue(): queue(CAPACITY) {}
+    bool try_enqueue(long data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.full()) {
+            return false;
+        }
+        queue.enqueue(data);
+        return true;
+    }
+    bool try_dequeue(long& data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.empty()) {
+            return false;
+        }
+        data = queue.dequeue();
+        return true;
+    }
+
+ private:
+    std::mutex mutex;
+    structures::ArrayQueue<long> queue;
+};
+
+/// Milhões de operações (enfileirar + desenfileirar) por segundo com uma
+/// produtora e uma consumidora passando ops elementos
+template<typename Queue>
+double two_threads(Queue& queue, std::size_t ops) {
+    long sum = 0;
+    double elapsed = bench::run_threads(2, [&](unsigned id) {
+        if (id == 0) {
+            for (std::size_t i = 0; i < ops; i++) {
+                while (!queue.try_enqueue(static_cast<long>(i))) {
+                    std::this_thread::yield();
+                }
+            }
+        } else {
+            long data;
+            for (std::size_t i = 0; i < ops; i++) {
+                while (!queue.try_dequeue(data)) {
+                    std::this_thread::yield();
+                }
+                sum += data;
+            }
+        }
+    });
+    bench::keep(sum);
+    return 2.0 * ops / elapsed / 1e6;
+}
+
+/// Idem, numa thread só: rajadas de CAPACITY elementos
+template<typename Queue>
+double one_thread(Queue& queue, std::size_t ops) {
+    std::size_t rounds = ops / CAPACITY > 0 ? ops / CAPACITY : 1;
+    double elapsed = bench::seconds([&] {
+        long sum = 0, data = 0;
+        for (std::size_t r = 0; r < rounds; r++) {
+            for (std::size_t i = 0; i < CAPACITY; i++) {
+                queue.try_enqueue(static_cast<long>(i));
+            }
+            for (std::size_t i = 0; i < CAPACITY; i++) {
+                queue.try_dequeue(data);
+                sum += data;
+            }
+        }
+        bench::keep(sum);
+    });
+    return 2.0 * rounds * CAPACITY / elapsed / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t ops = bench::scaled(100000000, bench::scale(argc, argv));
+
+    structures::SpscArrayQueue<long> spsc(CAPACITY);
+    LockedQueue locked;
+    std::printf("%10s %14s %14s\n", "", "spsc Mops/s", "mutex Mops/s");
+    std::printf("%10s %14.1f %14.1f\n", "1 thread", one_thread(spsc, ops),
+                one_thread(locked, ops / 10));
+    std::printf("%10s %14.1f %14.1f\n", "2 threads", two_threads(spsc, ops),
+                two_threads(locked, ops / 10));
+    return 0;
+}
@@ -0,0 +1,236 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_MPMC_ARRAY_QUEUE_H
+#define STRUCTURES_MPMC_ARRAY_QUEUE_H
+
+#include <atomic>
+#include <cstdint>  /// std::size_t, std::intptr_t
+#include <new>  /// placement new
+#include <stdexcept>  /// C++ Exceptions
+#include <type_traits>  /// std::is_nothrow_constructible
+#include <utility>  /// std::move, std::forward
+
+namespace structures {
+
+template<typename T>
+/// classe MpmcArrayQueue: fila circular limitada lock-free para varios
+/// produtores e varios consumidores, com numero de sequencia por posicao
+class MpmcArrayQueue {
+    // Uma posicao reservada precisa ser publicada: se o dado nao puder ser
+    // movido para ela sem excecao, os consumidores esperariam para sempre.
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "elementos devem ter construtor de movimento noexcept");
+
+ public:
+    /// construtor padrao
+    MpmcArrayQueue();
+    /// construtor com parametro (deve ser potencia de 2)
+    explicit MpmcArrayQueue(std::size_t max);
+    /// destrutor padrao
+    ~MpmcArrayQueue();
+    /// copia nao suportada
+    MpmcArrayQueue(const MpmcArrayQueue&) = delete;
+    /// atribuicao nao suportada
+    MpmcArrayQueue& operator=(const MpmcArrayQueue&) = delete;
+    /// metodo enfileirar
+    void enqueue(const T& data);
+    /// metodo enfileirar movendo o dado
+    void enqueue(T&& data);
+    /// metodo enfileirar sem excecao; false se cheia
+    template<typename... Args>
+    bool try_enqueue(Args&&... args);
+    /// metodo desenfileirar
+    T dequeue();
+    /// metodo desenfileirar sem excecao; false se vazia
+    bool try_dequeue(T& data);
+    /// metodo retorna tamanho atual (aproximado se houver concorrencia)
+    std::size_t size() const;
+    /// metodo retorna tamanho maximo
+    std::size_t max_size() const;
+    /// metodo verifica se vazio
+    bool empty() const;
+    /// metodo verifica se esta cheio
+    bool full() const;
+
+ private:
+    static const std::size_t CACHE_LINE = 64;
+
+    /// constroi o dado direto na posicao reservada
+    template<typename... Args>
+    bool try_emplace(std::true_type, Args&&... args);
+    /// constroi o dado antes de reservar a posicao, pois pode lancar
+    template<typename... Args>
+    bool try_emplace(std::false_type, Args&&... args);
+
+    /// Posicao do vetor: o numero de sequencia diz se ela esta livre
+    /// para o produtor da volta atual ou pronta para o consumidor
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* data() {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    Cell* contents;
+    std::size_t max_size_;
+    std::size_t mask_;  /// max_size_ - 1, substitui o modulo
+
+    /// proxima posicao de escrita
+    alignas(CACHE_LINE) std::atomic<std::size_t> end_{0};
+    /// proxima posicao de leitura
+    alignas(CACHE_LINE) std::atomic<std::size_t> begin_{0};
+
+    static const auto DEFAULT_SIZE = 16u;
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::MpmcArrayQueue<T>::MpmcArrayQueue():
+    MpmcArrayQueue(DEFAULT_SIZE)
+{}
+
+template<typename T>
+structures::MpmcArrayQueue<T>::MpmcArrayQueue(std::size_t max) {
+    if (max < 2 || (max & (max - 1)) != 0) {
+        throw std::invalid_argument("tamanho deve ser potencia de 2");
+    }
+    max_size_ = max;
+    mask_ = max - 1;
+    contents = new Cell[max_size_];
+    for (std::size_t i = 0; i < max_size_; i++) {
+        contents[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+structures::MpmcArrayQueue<T>::~MpmcArrayQueue() {
+    std::size_t end = end_.load(std::memory_order_relaxed);
+    for (std::size_t i = begin_.load(std::memory_order_relaxed);
+         i != end; i++) {
+        contents[i & mask_].data()->~T();
+    }
+    delete [] contents;
+}
+
+template<typename T>
+void structures::MpmcArrayQueue<T>::enqueue(const T& data) {
+    if (!try_enqueue(data)) {
+        throw std::out_of_range("fila cheia");
+    }
+}
+
+template<typename T>
+void structures::MpmcArrayQueue<T>::enqueue(T&& data) {
+    if (!try_enqueue(std::move(data))) {
+        throw std::out_of_range("fila cheia");
+    }
+}
+
+template<typename T>
+template<typename... Args>
+bool structures::MpmcArrayQueue<T>::try_enqueue(Args&&... args) {
+    return try_emplace(std::is_nothrow_constructible<T, Args&&...>(),
+                       std::forward<Args>(args)...);
+}
+
+template<typename T>
+template<typename... Args>
+bool structures::MpmcArrayQueue<T>::try_emplace(std::false_type,
+                                                Args&&... args) {
+    T value(std::forward<Args>(args)...);
+    return try_emplace(std::true_type(), std::move(value));
+}
+
+template<typename T>
+template<typename... Args>
+bool structures::MpmcArrayQueue<T>::try_emplace(std::true_type,
+                                                Args&&... args) {
+    Cell* cell;
+    std::size_t position = end_.load(std::memory_order_relaxed);
+    while (true) {
+        cell = &contents[position & mask_];
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) -
+                             static_cast<std::intptr_t>(position);
+        if (diff == 0) {
+            // Posicao livre: tenta reserva-la.
+            if (end_.compare_exchange_weak(position, position + 1,
+                                           std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Posicao ainda ocupada da volta anterior: cheia.
+            return false;
+        } else {
+            position = end_.load(std::memory_order_relaxed);
+        }
+    }
+    new (cell->data()) T(std::forward<Args>(args)...);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+T structures::MpmcArrayQueue<T>::dequeue() {
+    T data;
+    if (!try_dequeue(data)) {
+        throw std::out_of_range("fila vazia");
+    }
+    return data;
+}
+
+template<typename T>
+bool structures::MpmcArrayQueue<T>::try_dequeue(T& data) {
+    Cell* cell;
+    std::size_t position = begin_.load(std::memory_order_relaxed);
+    while (true) {
+        cell = &contents[position & mask_];
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = static_cast<std::intptr_t>(sequence) -
+                             static_cast<std::intptr_t>(position + 1);
+        if (diff == 0) {
+            // Posicao preenchida: tenta reserva-la.
+            if (begin_.compare_exchange_weak(position, position + 1,
+                                             std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Produtor ainda nao escreveu: vazia.
+            return false;
+        } else {
+            position = begin_.load(std::memory_order_relaxed);
+        }
+    }
+    T value(std::move(*cell->data()));
+    cell->data()->~T();
+    // Libera a posicao para o produtor da proxima volta.
+    cell->sequence.store(position + max_size_, std::memory_order_release);
+    data = std::move(value);
+    return true;
+}
+
+template<typename T>
+std::size_t structures::MpmcArrayQueue<T>::size() const {
+    std::size_t begin = begin_.load(std::memory_order_relaxed);
+    std::size_t end = end_.load(std::memory_order_relaxed);
+    return end > begin ? end - begin : 0;
+}
+
+template<typename T>
+std::size_t structures::MpmcArrayQueue<T>::max_size() const {
+    return max_size_;
+}
+
+template<typename T>
+bool structures::MpmcArrayQueue<T>::empty() const {
+    return (size() == 0);
+}
+
+template<typename T>
+bool structures::MpmcArrayQueue<T>::full() const {
+    return (size() >= max_size_);
+}
+
+#endif
@@ -0,0 +1,180 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_SPSC_ARRAY_QUEUE_H
+#define STRUCTURES_SPSC_ARRAY_QUEUE_H
+
+#include <atomic>
+#include <cstdint>  /// std::size_t
+#include <memory>  /// std::allocator
+#include <new>  /// placement new
+#include <stdexcept>  /// C++ Exceptions
+#include <utility>  /// std::move, std::forward
+
+namespace structures {
+
+template<typename T>
+/// classe SpscArrayQueue: fila circular lock-free para exatamente uma
+/// thread produtora e uma thread consumidora
+class SpscArrayQueue {
+ public:
+    /// construtor padrao
+    SpscArrayQueue();
+    /// construtor com parametro (deve ser potencia de 2)
+    explicit SpscArrayQueue(std::size_t max);
+    /// destrutor padrao
+    ~SpscArrayQueue();
+    /// copia nao suportada
+    SpscArrayQueue(const SpscArrayQueue&) = delete;
+    /// atribuicao nao suportada
+    SpscArrayQueue& operator=(const SpscArrayQueue&) = delete;
+    /// metodo enfileirar (produtor)
+    void enqueue(const T& data);
+    /// metodo enfileirar movendo o dado (produtor)
+    void enqueue(T&& data);
+    /// metodo enfileirar sem excecao; false se cheia (produtor)
+    template<typename... Args>
+    bool try_enqueue(Args&&... args);
+    /// metodo desenfileirar (consumidor)
+    T dequeue();
+    /// metodo desenfileirar sem excecao; false se vazia (consumidor)
+    bool try_dequeue(T& data);
+    /// metodo retorna tamanho atual (aproximado se houver concorrencia)
+    std::size_t size() const;
+    /// metodo retorna tamanho maximo
+    std::size_t max_size() const;
+    /// metodo verifica se vazio
+    bool empty() const;
+    /// metodo verifica se esta cheio
+    bool full() const;
+
+ private:
+    static const std::size_t CACHE_LINE = 64;
+
+    T* contents;
+    std::size_t max_size_;
+    std::size_t mask_;  /// max_size_ - 1, substitui o modulo
+
+    /// indice do inicio, escrito so pelo consumidor
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_{0};
+    /// copia local do fim vista pelo consumidor
+    std::size_t cached_tail_{0};
+    /// indice do fim, escrito so pelo produtor
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0};
+    /// copia local do inicio vista pelo produtor
+    std::size_t cached_head_{0};
+
+    static const auto DEFAULT_SIZE = 16u;
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::SpscArrayQueue<T>::SpscArrayQueue():
+    SpscArrayQueue(DEFAULT_SIZE)
+{}
+
+template<typename T>
+structures::SpscArrayQueue<T>::SpscArrayQueue(std::size_t max) {
+    if (max == 0 || (max & (max - 1)) != 0) {
+        throw std::invalid_argument("tamanho deve ser potencia de 2");
+    }
+    max_size_ = max;
+    mask_ = max - 1;
+    contents = std::allocator<T>().allocate(max_size_);
+}
+
+template<typename T>
+structures::SpscArrayQueue<T>::~SpscArrayQueue() {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    for (std::size_t i = head_.load(std::memory_order_relaxed);
+         i != tail; i++) {
+        contents[i & mask_].~T();
+    }
+    std::allocator<T>().deallocate(contents, max_size_);
+}
+
+template<typename T>
+void structures::SpscArrayQueue<T>::enqueue(const T& data) {
+    if (!try_enqueue(data)) {
+        throw std::out_of_range("fila cheia");
+    }
+}
+
+template<typename T>
+void structures::SpscArrayQueue<T>::enqueue(T&& data) {
+    if (!try_enqueue(std::move(data))) {
+        throw std::out_of_range("fila cheia");
+    }
+}
+
+template<typename T>
+template<typename... Args>
+bool structures::SpscArrayQueue<T>::try_enqueue(Args&&... args) {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == max_size_) {
+        // So rele o indice do consumidor quando parece cheio.
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail - cached_head_ == max_size_) {
+            return false;
+        }
+    }
+    new (contents + (tail & mask_)) T(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+T structures::SpscArrayQueue<T>::dequeue() {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) {
+            throw std::out_of_range("fila vazia");
+        }
+    }
+    T* slot = contents + (head & mask_);
+    T data = std::move(*slot);
+    slot->~T();
+    head_.store(head + 1, std::memory_order_release);
+    return data;
+}
+
+template<typename T>
+bool structures::SpscArrayQueue<T>::try_dequeue(T& data) {
+    std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+        // So rele o indice do produtor quando parece vazia.
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head == cached_tail_) {
+            return false;
+        }
+    }
+    T* slot = contents + (head & mask_);
+    data = std::move(*slot);
+    slot->~T();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+std::size_t structures::SpscArrayQueue<T>::size() const {
+    std::size_t head = head_.load(std::memory_order_acquire);
+    std::size_t tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+template<typename T>
+std::size_t structures::SpscArrayQueue<T>::max_size() const {
+    return max_size_;
+}
+
+template<typename T>
+bool structures::SpscArrayQueue<T>::empty() const {
+    return (size() == 0);
+}
+
+template<typename T>
+bool structures::SpscArrayQueue<T>::full() const {
+    return (size() == max_size_);
+}
+
+#endif
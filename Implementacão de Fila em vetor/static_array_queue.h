@@ -0,0 +1,184 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_STATIC_ARRAY_QUEUE_H
+#define STRUCTURES_STATIC_ARRAY_QUEUE_H
+
+#include <cstdint>  /// std::size_t
+#include <new>  /// placement new
+#include <stdexcept>  /// C++ Exceptions
+#include <type_traits>  /// std::is_nothrow_move_constructible
+#include <utility>  /// std::move, std::forward
+
+namespace structures {
+
+template<typename T, std::size_t N>
+/// classe StaticArrayQueue: fila circular com capacidade N (potencia de 2)
+/// fixada em tempo de compilacao e elementos guardados no proprio objeto
+class StaticArrayQueue {
+    static_assert(N > 0 && (N & (N - 1)) == 0,
+                  "capacidade deve ser potencia de 2");
+
+ public:
+    /// construtor padrao
+    StaticArrayQueue() = default;
+    /// destrutor padrao
+    ~StaticArrayQueue();
+    /// copia nao suportada
+    StaticArrayQueue(const StaticArrayQueue&) = delete;
+    /// atribuicao nao suportada
+    StaticArrayQueue& operator=(const StaticArrayQueue&) = delete;
+    /// construtor por movimento: move os elementos um a um (o buffer e
+    /// interno); other fica vazia
+    StaticArrayQueue(StaticArrayQueue&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+    /// atribuicao por movimento; other fica vazia
+    StaticArrayQueue& operator=(StaticArrayQueue&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+    /// metodo enfileirar
+    void enqueue(const T& data);
+    /// metodo enfileirar movendo o dado
+    void enqueue(T&& data);
+    /// metodo enfileirar construindo o dado no lugar
+    template<typename... Args>
+    T& emplace(Args&&... args);
+    /// metodo desenfileirar
+    T dequeue();
+    /// metodo retorna o ultimo
+    T& back();
+    /// metodo limpa a fila
+    void clear();
+    /// metodo retorna tamanho atual
+    std::size_t size() const;
+    /// metodo retorna tamanho maximo
+    static constexpr std::size_t max_size() {
+        return N;
+    }
+    /// metodo verifica se vazio
+    bool empty() const;
+    /// metodo verifica se esta cheio
+    bool full() const;
+
+ private:
+    /// indice fisico de uma posicao logica (sem divisao)
+    static constexpr std::size_t wrap(std::size_t index) {
+        return index & MASK;
+    }
+    T* slot(std::size_t index) {
+        return reinterpret_cast<T*>(buffer_) + wrap(index);
+    }
+    /// move os elementos de other para esta fila (vazia), a partir do 0
+    void take(StaticArrayQueue& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+
+    static constexpr std::size_t MASK = N - 1;
+
+    alignas(T) unsigned char buffer_[N * sizeof(T)];
+    std::size_t begin_{0};  /// indice do inicio
+    std::size_t size_{0};
+};
+
+}  // namespace structures
+
+template<typename T, std::size_t N>
+structures::StaticArrayQueue<T, N>::StaticArrayQueue(
+        StaticArrayQueue&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value) {
+    take(other);
+}
+
+template<typename T, std::size_t N>
+structures::StaticArrayQueue<T, N>::~StaticArrayQueue() {
+    clear();
+}
+
+template<typename T, std::size_t N>
+structures::StaticArrayQueue<T, N>&
+structures::StaticArrayQueue<T, N>::operator=(StaticArrayQueue&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+        clear();
+        take(other);
+    }
+    return *this;
+}
+
+template<typename T, std::size_t N>
+void structures::StaticArrayQueue<T, N>::enqueue(const T& data) {
+    emplace(data);
+}
+
+template<typename T, std::size_t N>
+void structures::StaticArrayQueue<T, N>::enqueue(T&& data) {
+    emplace(std::move(data));
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+T& structures::StaticArrayQueue<T, N>::emplace(Args&&... args) {
+    if (full()) {
+        throw std::out_of_range("fila cheia");
+    } else {
+        T* data = new (slot(begin_ + size_)) T(std::forward<Args>(args)...);
+        size_++;
+        return *data;
+    }
+}
+
+template<typename T, std::size_t N>
+T structures::StaticArrayQueue<T, N>::dequeue() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        T* first = slot(begin_);
+        T data = std::move(*first);
+        first->~T();
+        begin_ = wrap(begin_ + 1);
+        size_--;
+        return data;
+    }
+}
+
+template<typename T, std::size_t N>
+T& structures::StaticArrayQueue<T, N>::back() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        return *slot(begin_ + size_ - 1);
+    }
+}
+
+template<typename T, std::size_t N>
+void structures::StaticArrayQueue<T, N>::clear() {
+    while (size_ > 0) {
+        slot(begin_)->~T();
+        begin_ = wrap(begin_ + 1);
+        size_--;
+    }
+    begin_ = 0;
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::StaticArrayQueue<T, N>::size() const {
+    return size_;
+}
+
+template<typename T, std::size_t N>
+bool structures::StaticArrayQueue<T, N>::empty() const {
+    return (size_ == 0);
+}
+
+template<typename T, std::size_t N>
+bool structures::StaticArrayQueue<T, N>::full() const {
+    return (size_ == N);
+}
+
+template<typename T, std::size_t N>
+void structures::StaticArrayQueue<T, N>::take(StaticArrayQueue& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value) {
+    for (std::size_t i = 0; i < other.size_; i++) {
+        new (slot(i)) T(std::move(*other.slot(other.begin_ + i)));
+    }
+    size_ = other.size_;
+    other.clear();
+}
+
+#endif
@@ -0,0 +1,90 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_array_deque.cpp
+
+#include "gtest/gtest.h"
+#include "array_deque.h"
+#include "array_deque.h"
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(ArrayDequeTest, CapacityRoundsToPowerOfTwo) {
+    structures::ArrayDeque<int> deque{5u};
+    ASSERT_EQ(8u, deque.max_size());
+    deque.reserve(9u);
+    ASSERT_EQ(16u, deque.max_size());
+}
+
+TEST(ArrayDequeTest, BothEndsAndGrowth) {
+    structures::ArrayDeque<std::string> deque{2u};
+    for (auto i = 0; i < 50; ++i) {
+        deque.push_back(std::to_string(i));
+        deque.push_front(std::to_string(-i));
+    }
+    ASSERT_EQ(100u, deque.size());
+    ASSERT_EQ("-49", deque.front());
+    ASSERT_EQ("49", deque.back());
+    ASSERT_EQ("0", deque.at(49));
+    ASSERT_EQ("0", deque[50]);
+    ASSERT_THROW(deque.at(100), std::out_of_range);
+    for (auto i = 49; i >= 0; --i) {
+        ASSERT_EQ(std::to_string(-i), deque.pop_front());
+        ASSERT_EQ(std::to_string(i), deque.pop_back());
+    }
+    ASSERT_TRUE(deque.empty());
+    ASSERT_THROW(deque.pop_front(), std::out_of_range);
+    ASSERT_THROW(deque.pop_back(), std::out_of_range);
+}
+
+TEST(ArrayDequeTest, PushOwnElementWhenFull) {
+    structures::ArrayDeque<std::string> deque{1u};
+    deque.push_back(std::string(100, 'x'));
+    deque.push_back(deque.front());
+    ASSERT_EQ(std::string(100, 'x'), deque.back());
+    deque.push_front(deque.back());
+    ASSERT_EQ(4u, deque.max_size());
+    deque.push_back("y");
+    deque.push_front(deque.at(3));
+    ASSERT_EQ(5u, deque.size());
+    ASSERT_EQ("y", deque.front());
+    ASSERT_EQ(std::string(100, 'x'), deque.at(1));
+    ASSERT_EQ(std::string(100, 'x'), deque.at(3));
+}
+
+TEST(ArrayDequeTest, MoveStealsTheRing) {
+    using Deque = structures::ArrayDeque<std::string>;
+    static_assert(std::is_nothrow_move_constructible<Deque>::value &&
+                  std::is_nothrow_move_assignable<Deque>::value,
+                  "movimento nao deve lancar");
+    Deque deque{4u};
+    for (auto i = 0; i < 4; ++i) {
+        deque.push_front(std::to_string(i));
+    }
+    const std::string* data = &deque.front();
+    Deque moved(std::move(deque));
+    ASSERT_EQ(data, &moved.front());
+    ASSERT_EQ(4u, moved.size());
+    ASSERT_TRUE(deque.empty());
+    ASSERT_EQ(0u, deque.max_size());
+    // A fila movida volta a crescer normalmente.
+    deque.push_back("a");
+    deque.push_front("b");
+    ASSERT_EQ("b", deque.pop_front());
+    Deque other;
+    other = std::move(moved);
+    ASSERT_TRUE(moved.empty());
+    for (auto i = 0; i < 4; ++i) {
+        ASSERT_EQ(std::to_string(i), other.pop_back());
+    }
+    other = std::move(deque);
+    ASSERT_EQ("a", other.front());
+    moved.reserve(3u);
+    ASSERT_EQ(4u, moved.max_size());
+}
@@ -0,0 +1,127 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_array_queue.cpp
+
+#include "gtest/gtest.h"
+#include "array_queue.h"
+#include "array_queue.h"
+#include "../tests_memory_resource.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+/// Conta instancias vivas; a copia lanca quando copies_left chega a zero.
+struct Counted {
+    static int alive;
+    static int copies_left;
+
+    explicit Counted(int value_ = 0): value{value_} {
+        alive++;
+    }
+    Counted(const Counted& other): value{other.value} {
+        if (copies_left-- == 0) {
+            throw std::runtime_error("copia");
+        }
+        alive++;
+    }
+    ~Counted() {
+        alive--;
+    }
+    Counted& operator=(const Counted&) = default;
+
+    int value;
+};
+
+int Counted::alive = 0;
+int Counted::copies_left = -1;
+
+}  // namespace
+
+TEST(ArrayQueueBulkTest, EnqueueAndDequeueBulk) {
+    structures::ArrayQueue<int> queue{8u};
+    int in[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ASSERT_EQ(5u, queue.enqueue_bulk(in, 5));
+    int out[10] = {};
+    ASSERT_EQ(3u, queue.dequeue_bulk(out, 3));
+    ASSERT_EQ(0, out[0]);
+    ASSERT_EQ(2, out[2]);
+    // Da a volta no vetor e so cabem 6.
+    ASSERT_EQ(6u, queue.enqueue_bulk(in, 10));
+    ASSERT_TRUE(queue.full());
+    auto spans = queue.peek_spans();
+    ASSERT_EQ(5u, spans.first.size);
+    ASSERT_EQ(3u, spans.second.size);
+    ASSERT_EQ(3, spans.first.data[0]);
+    ASSERT_EQ(3, spans.second.data[0]);
+    queue.consume(2);
+    ASSERT_EQ(6u, queue.dequeue_bulk(out, 10));
+    ASSERT_EQ(0, out[0]);
+    ASSERT_EQ(5, out[5]);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_THROW(queue.consume(1), std::out_of_range);
+}
+
+TEST(ArrayQueueBulkTest, EnqueueBulkThrowingInSecondSegment) {
+    {
+        structures::ArrayQueue<Counted> queue{4u};
+        queue.enqueue(Counted(0));
+        queue.enqueue(Counted(1));
+        queue.enqueue(Counted(2));
+        queue.dequeue();
+        queue.dequeue();
+        Counted in[3] = {Counted(3), Counted(4), Counted(5)};
+        // Um elemento no fim do vetor, depois lanca no inicio.
+        Counted::copies_left = 1;
+        ASSERT_THROW(queue.enqueue_bulk(in, 3), std::runtime_error);
+        Counted::copies_left = -1;
+        ASSERT_EQ(1u, queue.size());
+        ASSERT_EQ(4, Counted::alive);
+    }
+    ASSERT_EQ(0, Counted::alive);
+}
+
+TEST(ArrayQueueBulkTest, CopyThrowingInSecondSegment) {
+    {
+        structures::ArrayQueue<Counted> queue{4u};
+        for (auto i = 0; i < 4; ++i) {
+            queue.enqueue(Counted(i));
+        }
+        queue.dequeue();
+        queue.dequeue();
+        queue.enqueue(Counted(4));
+        Counted::copies_left = 2;
+        ASSERT_THROW(structures::ArrayQueue<Counted> copy(queue),
+                     std::runtime_error);
+        Counted::copies_left = -1;
+        ASSERT_EQ(3, Counted::alive);
+        structures::ArrayQueue<Counted> copy(queue);
+        ASSERT_EQ(2, copy.dequeue().value);
+        ASSERT_EQ(4, copy.back().value);
+    }
+    ASSERT_EQ(0, Counted::alive);
+}
+
+#if __cplusplus >= 201703L
+TEST(ArrayQueueAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::ArrayQueue<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(100, resource);
+        },
+        [](C& container, std::string value) {
+            container.enqueue(std::move(value));
+        },
+        [](C& queue, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_EQ(tests::long_value(i), queue.dequeue());
+            }
+        });
+}
+#endif
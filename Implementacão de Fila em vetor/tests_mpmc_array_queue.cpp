@@ -0,0 +1,104 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_mpmc_array_queue.cpp
+
+#include "gtest/gtest.h"
+#include "mpmc_array_queue.h"
+#include "mpmc_array_queue.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+/// Dado cuja copia lanca quando pedido; o movimento nunca lanca.
+struct ThrowingCopy {
+    ThrowingCopy() = default;
+    explicit ThrowingCopy(int value_): value{value_} {}
+    ThrowingCopy(const ThrowingCopy& other): value{other.value} {
+        if (other.throw_on_copy) {
+            throw std::runtime_error("copia");
+        }
+    }
+    ThrowingCopy(ThrowingCopy&& other) noexcept = default;
+    ThrowingCopy& operator=(ThrowingCopy&& other) noexcept = default;
+
+    int value{0};
+    bool throw_on_copy{false};
+};
+
+}  // namespace
+
+TEST(MpmcArrayQueueTest, FifoAndFull) {
+    ASSERT_THROW(structures::MpmcArrayQueue<int>{1u}, std::invalid_argument);
+    structures::MpmcArrayQueue<std::string> queue{4u};
+    for (auto round = 0; round < 5; ++round) {
+        for (auto i = 0; i < 4; ++i) {
+            queue.enqueue(std::to_string(i));
+        }
+        ASSERT_TRUE(queue.full());
+        ASSERT_FALSE(queue.try_enqueue("x"));
+        ASSERT_THROW(queue.enqueue("x"), std::out_of_range);
+        for (auto i = 0; i < 4; ++i) {
+            ASSERT_EQ(std::to_string(i), queue.dequeue());
+        }
+        ASSERT_TRUE(queue.empty());
+    }
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+}
+
+TEST(MpmcArrayQueueTest, ThrowingConstructorLeavesQueueUsable) {
+    structures::MpmcArrayQueue<ThrowingCopy> queue{4u};
+    ThrowingCopy bad{1};
+    bad.throw_on_copy = true;
+    ASSERT_THROW(queue.enqueue(bad), std::runtime_error);
+    ASSERT_TRUE(queue.empty());
+    queue.enqueue(ThrowingCopy{2});
+    ThrowingCopy data;
+    ASSERT_TRUE(queue.try_dequeue(data));
+    ASSERT_EQ(2, data.value);
+    ASSERT_FALSE(queue.try_dequeue(data));
+}
+
+TEST(MpmcArrayQueueTest, ConcurrentProducersAndConsumers) {
+    const int threads = 4;
+    const int per_thread = 50000;
+    structures::MpmcArrayQueue<int> queue{128u};
+    std::vector<std::atomic<int>> seen(threads * per_thread);
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> workers;
+    for (auto t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (auto i = 0; i < per_thread; ++i) {
+                while (!queue.try_enqueue(t * per_thread + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        workers.emplace_back([&] {
+            int data;
+            while (consumed.load() < threads * per_thread) {
+                if (queue.try_dequeue(data)) {
+                    seen[data].fetch_add(1);
+                    consumed.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    ASSERT_TRUE(queue.empty());
+    for (auto& count : seen) {
+        ASSERT_EQ(1, count.load());
+    }
+}
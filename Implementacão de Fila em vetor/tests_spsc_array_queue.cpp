@@ -0,0 +1,78 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_spsc_array_queue.cpp
+
+#include "gtest/gtest.h"
+#include "spsc_array_queue.h"
+#include "spsc_array_queue.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(SpscArrayQueueTest, PowerOfTwoSize) {
+    ASSERT_THROW(structures::SpscArrayQueue<int>{0u}, std::invalid_argument);
+    ASSERT_THROW(structures::SpscArrayQueue<int>{6u}, std::invalid_argument);
+    structures::SpscArrayQueue<int> queue{8u};
+    ASSERT_EQ(8u, queue.max_size());
+}
+
+TEST(SpscArrayQueueTest, FifoAndWrapAround) {
+    structures::SpscArrayQueue<std::string> queue{4u};
+    for (auto round = 0; round < 10; ++round) {
+        for (auto i = 0; i < 4; ++i) {
+            queue.enqueue(std::to_string(round * 4 + i));
+        }
+        ASSERT_TRUE(queue.full());
+        ASSERT_FALSE(queue.try_enqueue("x"));
+        ASSERT_THROW(queue.enqueue("x"), std::out_of_range);
+        for (auto i = 0; i < 4; ++i) {
+            ASSERT_EQ(std::to_string(round * 4 + i), queue.dequeue());
+        }
+        ASSERT_TRUE(queue.empty());
+    }
+    std::string data;
+    ASSERT_FALSE(queue.try_dequeue(data));
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+}
+
+TEST(SpscArrayQueueTest, DestroysRemainingElements) {
+    auto shared = std::make_shared<int>(0);
+    {
+        structures::SpscArrayQueue<std::shared_ptr<int>> queue{4u};
+        queue.enqueue(shared);
+        queue.enqueue(shared);
+        ASSERT_EQ(3, shared.use_count());
+    }
+    ASSERT_EQ(1, shared.use_count());
+}
+
+TEST(SpscArrayQueueTest, ProducerAndConsumer) {
+    const int total = 200000;
+    structures::SpscArrayQueue<int> queue{64u};
+    std::thread producer([&] {
+        for (auto i = 0; i < total; ++i) {
+            while (!queue.try_enqueue(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int data = -1;
+    int out_of_order = 0;
+    for (auto i = 0; i < total; ++i) {
+        while (!queue.try_dequeue(data)) {
+            std::this_thread::yield();
+        }
+        if (data != i) {
+            out_of_order++;
+        }
+    }
+    producer.join();
+    ASSERT_EQ(0, out_of_order);
+    ASSERT_TRUE(queue.empty());
+}
@@ -0,0 +1,92 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_static_array_queue.cpp
+
+#include "gtest/gtest.h"
+#include "static_array_queue.h"
+#include "static_array_queue.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(StaticArrayQueueTest, CapacityIsCompileTime) {
+    static_assert(structures::StaticArrayQueue<int, 8>::max_size() == 8,
+                  "capacidade em tempo de compilacao");
+    structures::StaticArrayQueue<int, 8> queue;
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(0u, queue.size());
+}
+
+TEST(StaticArrayQueueTest, FifoAndWrapAround) {
+    structures::StaticArrayQueue<std::string, 4> queue;
+    for (auto i = 0; i < 3; ++i) {
+        queue.enqueue(std::to_string(i));
+    }
+    for (auto i = 3; i < 20; ++i) {
+        ASSERT_EQ(std::to_string(i - 3), queue.dequeue());
+        queue.emplace(std::to_string(i));
+        ASSERT_EQ(std::to_string(i), queue.back());
+    }
+    queue.enqueue("x");
+    ASSERT_TRUE(queue.full());
+    ASSERT_THROW(queue.enqueue("y"), std::out_of_range);
+    ASSERT_EQ("17", queue.dequeue());
+}
+
+TEST(StaticArrayQueueTest, EmptyQueue) {
+    structures::StaticArrayQueue<int, 2> queue;
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+    ASSERT_THROW(queue.back(), std::out_of_range);
+}
+
+TEST(StaticArrayQueueTest, ClearDestroysElements) {
+    auto shared = std::make_shared<int>(0);
+    structures::StaticArrayQueue<std::shared_ptr<int>, 4> queue;
+    queue.enqueue(shared);
+    queue.enqueue(shared);
+    ASSERT_EQ(3, shared.use_count());
+    queue.clear();
+    ASSERT_EQ(1, shared.use_count());
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(StaticArrayQueueTest, MoveElementsOneByOne) {
+    using Queue = structures::StaticArrayQueue<std::string, 4>;
+    static_assert(std::is_nothrow_move_constructible<Queue>::value &&
+                  std::is_nothrow_move_assignable<Queue>::value,
+                  "movimento nao deve lancar");
+    Queue queue;
+    // Da a volta no anel antes de mover.
+    for (auto i = 0; i < 3; ++i) {
+        queue.enqueue(std::to_string(i));
+    }
+    queue.dequeue();
+    queue.dequeue();
+    for (auto i = 3; i < 6; ++i) {
+        queue.enqueue(std::to_string(i));
+    }
+    Queue moved(std::move(queue));
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(4u, moved.size());
+    ASSERT_EQ("5", moved.back());
+    queue.enqueue("x");
+    moved = std::move(queue);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(1u, moved.size());
+    ASSERT_EQ("x", moved.dequeue());
+    auto shared = std::make_shared<int>(0);
+    structures::StaticArrayQueue<std::shared_ptr<int>, 2> owners;
+    owners.enqueue(shared);
+    structures::StaticArrayQueue<std::shared_ptr<int>, 2> other(
+        std::move(owners));
+    ASSERT_EQ(2, shared.use_count());
+    other.clear();
+    ASSERT_EQ(1, shared.use_count());
+}
@@ -3,22 +3,56 @@
 #define STRUCTURES_ARRAY_STACK_H
 
 #include <cstdint>  /// std::size_t
+#include <cstring>  /// std::memcpy
+#include <memory>  /// std::allocator_traits, std::uninitialized_copy
+#include <new>  /// placement new
 #include <stdexcept>  /// C++ exceptions
+#include <type_traits>  /// std::is_trivially_copyable
+#include <utility>  /// std::move, std::forward, std::swap
+#if __cplusplus >= 201703L
+#include <memory_resource>  /// std::pmr::polymorphic_allocator
+#endif
 
 namespace structures {
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 /// Classe Pilha
 class ArrayStack {
  public:
+    using allocator_type = Allocator;
+
     /// construtor simples
     ArrayStack();
     /// construtor com parametro tamanho
     explicit ArrayStack(std::size_t max);
+    /// construtor com tamanho inicial, modo de crescimento e alocador
+    ArrayStack(std::size_t max, bool growable,
+               const Allocator& allocator = Allocator());
+    /// construtor com alocador
+    explicit ArrayStack(const Allocator& allocator);
+    /// construtor de copia: uma alocacao e uma copia em bloco
+    ArrayStack(const ArrayStack& other);
+    /// construtor de copia alocando com allocator
+    ArrayStack(const ArrayStack& other, const Allocator& allocator);
+    /// construtor de movimento: toma o vetor de other em O(1)
+    ArrayStack(ArrayStack&& other) noexcept;
     /// destrutor
     ~ArrayStack();
+    /// atribuicao por copia; o alocador de cada pilha nao muda
+    ArrayStack& operator=(const ArrayStack& other);
+    /// atribuicao por movimento: O(1) se o vetor puder trocar de dono
+    ArrayStack& operator=(ArrayStack&& other);
+    /// troca o conteudo com other em O(1)
+    void swap(ArrayStack& other) noexcept;
+    /// metodo retorna o alocador
+    Allocator get_allocator() const;
     /// metodo empilha
     void push(const T& data);
+    /// metodo empilha movendo o dado
+    void push(T&& data);
+    /// metodo empilha construindo o dado no lugar
+    template<typename... Args>
+    T& emplace(Args&&... args);
     /// metodo desempilha
     T pop();
     /// metodo retorna o topo
@@ -33,61 +67,210 @@ class ArrayStack {
     bool empty();
     /// verifica se esta cheia
     bool full();
+    /// verifica se cresce ao encher
+    bool growable();
+    /// garante capacidade para ao menos n elementos
+    void reserve(std::size_t n);
+    /// reduz a capacidade ao tamanho atual
+    void shrink_to_fit();
 
  private:
-    T* contents;
+    /// empilha quando o vetor esta cheio: cresce ou lanca
+    template<typename... Args>
+    T& emplace_full(Args&&... args);
+    /// realoca o vetor com nova capacidade
+    void reallocate(std::size_t new_size);
+    /// aloca memoria sem construir elementos
+    T* allocate(std::size_t n);
+    /// libera memoria alocada por allocate
+    void deallocate(T* p, std::size_t n);
+    /// toma o vetor de other, que fica vazia e sem capacidade
+    void steal(ArrayStack& other) noexcept;
+    /// movimento quando o alocador acompanha o vetor
+    void move_assign(ArrayStack& other, std::true_type);
+    /// movimento quando o alocador fica: so toma o vetor se for igual
+    void move_assign(ArrayStack& other, std::false_type);
+    /// troca os alocadores, se eles acompanham a troca
+    void swap_allocator(ArrayStack& other, std::true_type) noexcept;
+    void swap_allocator(ArrayStack& other, std::false_type) noexcept;
+
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    Allocator allocator_;
+    T* contents;  /// apenas [0, top_] contem elementos construidos
     int top_;
     std::size_t max_size_;
+    bool growable_{false};
 
     static const auto DEFAULT_SIZE = 10u;
+    static const auto GROWTH_FACTOR = 2u;
 };
 
-}  // namespace structures
-
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Pilha que aloca de um std::pmr::memory_resource
+template<typename T>
+using ArrayStack =
+    structures::ArrayStack<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 #endif
 
+}  // namespace structures
 
-template<typename T>
-structures::ArrayStack<T>::ArrayStack() {
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack() {
     max_size_ = DEFAULT_SIZE;
-    contents = new T[max_size_];
+    contents = allocate(max_size_);
     top_ = -1;
 }
 
-template<typename T>
-structures::ArrayStack<T>::ArrayStack(std::size_t max) {
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(std::size_t max) {
     max_size_ = max;
-    contents = new T[max_size_];
+    contents = allocate(max_size_);
     top_ = -1;
 }
 
-template<typename T>
-structures::ArrayStack<T>::~ArrayStack() {
-    delete [] contents;
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(std::size_t max, bool growable,
+                                                 const Allocator& allocator):
+    allocator_{allocator} {
+    max_size_ = max;
+    contents = allocate(max_size_);
+    top_ = -1;
+    growable_ = growable;
 }
 
-template<typename T>
-void structures::ArrayStack<T>::push(const T& data) {
-    if (full()) {
-        throw std::out_of_range("pilha cheia");
-    } else {
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(const Allocator& allocator):
+    allocator_{allocator} {
+    max_size_ = DEFAULT_SIZE;
+    contents = allocate(max_size_);
+    top_ = -1;
+}
+
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(const ArrayStack& other):
+    ArrayStack(other,
+               AllocatorTraits::select_on_container_copy_construction(
+                   other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(const ArrayStack& other,
+                                                 const Allocator& allocator):
+    allocator_{allocator} {
+    max_size_ = other.max_size_;
+    contents = allocate(max_size_);
+    try {
+        std::uninitialized_copy(other.contents, other.contents + other.top_ + 1,
+                                contents);
+    } catch (...) {
+        deallocate(contents, max_size_);
+        throw;
+    }
+    top_ = other.top_;
+    growable_ = other.growable_;
+}
+
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::ArrayStack(ArrayStack&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>::~ArrayStack() {
+    clear();
+    deallocate(contents, max_size_);
+}
+
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>&
+structures::ArrayStack<T, Allocator>::operator=(const ArrayStack& other) {
+    if (this != &other) {
+        ArrayStack copy(other, allocator_);
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::ArrayStack<T, Allocator>&
+structures::ArrayStack<T, Allocator>::operator=(ArrayStack&& other) {
+    if (this != &other) {
+        move_assign(other, typename AllocatorTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::swap(ArrayStack& other) noexcept {
+    std::swap(contents, other.contents);
+    std::swap(top_, other.top_);
+    std::swap(max_size_, other.max_size_);
+    std::swap(growable_, other.growable_);
+    swap_allocator(other,
+                   typename AllocatorTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::ArrayStack<T, Allocator>::get_allocator() const {
+    return allocator_;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::push(const T& data) {
+    emplace(data);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+T& structures::ArrayStack<T, Allocator>::emplace(Args&&... args) {
+    // Caminho comum curto, para ser expandido no chamador.
+    if (size() < max_size_) {
+        T* slot = new (contents + top_ + 1) T(std::forward<Args>(args)...);
         top_++;
-        contents[top_] = data;
+        return *slot;
     }
+    return emplace_full(std::forward<Args>(args)...);
 }
 
-template<typename T>
-T structures::ArrayStack<T>::pop() {
+template<typename T, typename Allocator>
+template<typename... Args>
+T& structures::ArrayStack<T, Allocator>::emplace_full(Args&&... args) {
+    if (!growable_) {
+        throw std::out_of_range("pilha cheia");
+    }
+    // Constroi antes de realocar: args pode referenciar a propria pilha.
+    T value(std::forward<Args>(args)...);
+    std::size_t new_size = max_size_ * GROWTH_FACTOR;
+    reallocate(new_size > 0 ? new_size : 1);
+    T* slot = new (contents + top_ + 1) T(std::move(value));
+    top_++;
+    return *slot;
+}
+
+template<typename T, typename Allocator>
+T structures::ArrayStack<T, Allocator>::pop() {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     } else {
+        T data = std::move(contents[top_]);
+        contents[top_].~T();
         top_--;
-        return contents[top_+1];
+        return data;
     }
 }
 
-template<typename T>
-T& structures::ArrayStack<T>::top() {
+template<typename T, typename Allocator>
+T& structures::ArrayStack<T, Allocator>::top() {
     if (empty()) {
         printf("ERRO: Pilha vazia ao acessar!");
         throw std::out_of_range("pilha vazia");
@@ -96,27 +279,133 @@ T& structures::ArrayStack<T>::top() {
     }
 }
 
-template<typename T>
-void structures::ArrayStack<T>::clear() {
-    top_ = -1;
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::clear() {
+    while (top_ >= 0) {
+        contents[top_].~T();
+        top_--;
+    }
 }
 
-template<typename T>
-std::size_t structures::ArrayStack<T>::size() {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayStack<T, Allocator>::size() {
     return (top_ + 1);
 }
 
-template<typename T>
-std::size_t structures::ArrayStack<T>::max_size() {
+template<typename T, typename Allocator>
+std::size_t structures::ArrayStack<T, Allocator>::max_size() {
     return max_size_;
 }
 
-template<typename T>
-bool structures::ArrayStack<T>::empty() {
+template<typename T, typename Allocator>
+bool structures::ArrayStack<T, Allocator>::empty() {
     return (top_ == -1);
 }
 
-template<typename T>
-bool structures::ArrayStack<T>::full() {
-    return (size() == max_size_ - 1);
+template<typename T, typename Allocator>
+bool structures::ArrayStack<T, Allocator>::full() {
+    return (!growable_ && size() == max_size_);
+}
+
+template<typename T, typename Allocator>
+bool structures::ArrayStack<T, Allocator>::growable() {
+    return growable_;
 }
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::reserve(std::size_t n) {
+    if (n > max_size_) {
+        reallocate(n);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::shrink_to_fit() {
+    if (size() < max_size_) {
+        reallocate(size());
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::reallocate(std::size_t new_size) {
+    T* new_contents = allocate(new_size);
+    std::size_t count = size();
+    if (std::is_trivially_copyable<T>::value) {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(new_contents),
+                        static_cast<const void*>(contents),
+                        count * sizeof(T));
+        }
+    } else {
+        for (std::size_t i = 0; i < count; i++) {
+            new (new_contents + i) T(std::move(contents[i]));
+            contents[i].~T();
+        }
+    }
+    deallocate(contents, max_size_);
+    contents = new_contents;
+    max_size_ = new_size;
+}
+
+template<typename T, typename Allocator>
+T* structures::ArrayStack<T, Allocator>::allocate(std::size_t n) {
+    return AllocatorTraits::allocate(allocator_, n);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::deallocate(T* p, std::size_t n) {
+    // pilha movida nao tem vetor
+    if (p != nullptr) {
+        AllocatorTraits::deallocate(allocator_, p, n);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::steal(ArrayStack& other) noexcept {
+    contents = other.contents;
+    top_ = other.top_;
+    max_size_ = other.max_size_;
+    growable_ = other.growable_;
+    other.contents = nullptr;
+    other.top_ = -1;
+    other.max_size_ = 0;
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::move_assign(ArrayStack& other,
+                                                       std::true_type) {
+    clear();
+    deallocate(contents, max_size_);
+    allocator_ = std::move(other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::move_assign(ArrayStack& other,
+                                                       std::false_type) {
+    clear();
+    if (allocator_ == other.allocator_) {
+        deallocate(contents, max_size_);
+        steal(other);
+        return;
+    }
+    // o vetor de other nao pode ser liberado por este alocador
+    reserve(other.size());
+    for (int i = 0; i <= other.top_; i++) {
+        emplace(std::move(other.contents[i]));
+    }
+    growable_ = other.growable_;
+    other.clear();
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::swap_allocator(
+        ArrayStack& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::ArrayStack<T, Allocator>::swap_allocator(
+        ArrayStack&, std::false_type) noexcept {}
+
+#endif
@@ -0,0 +1,58 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_array_stack.cpp
+///
+/// Vazão de push da ArrayStack que cresce contra std::vector::push_back,
+/// partindo da capacidade padrão, de 1K a 10M elementos.
+///
+///     g++ -std=c++14 -O2 bench_array_stack.cpp -o bench_array_stack
+
+#include "array_stack.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    double factor = bench::scale(argc, argv);
+    // Mesma quantidade total de pushes para cada tamanho.
+    std::size_t total = bench::scaled(50000000, factor);
+
+    std::printf("%10s %14s %14s %14s\n", "n", "vector ns/op",
+                "growable ns/op", "fixed ns/op");
+    for (std::size_t n = 1000; n <= 10000000; n *= 10) {
+        std::size_t rounds = total / n > 0 ? total / n : 1;
+        double ops = static_cast<double>(rounds * n);
+
+        double vector = bench::seconds([&] {
+            for (std::size_t r = 0; r < rounds; r++) {
+                std::vector<int> stack;
+                for (std::size_t i = 0; i < n; i++) {
+                    stack.push_back(static_cast<int>(i));
+                }
+                bench::keep(stack.back());
+            }
+        });
+        double growable = bench::seconds([&] {
+            for (std::size_t r = 0; r < rounds; r++) {
+                structures::ArrayStack<int> stack(10u, true);
+                for (std::size_t i = 0; i < n; i++) {
+                    stack.push(static_cast<int>(i));
+                }
+                bench::keep(stack.top());
+            }
+        });
+        // Referência: capacidade exata, sem crescer.
+        double fixed = bench::seconds([&] {
+            for (std::size_t r = 0; r < rounds; r++) {
+                structures::ArrayStack<int> stack(n);
+                for (std::size_t i = 0; i < n; i++) {
+                    stack.push(static_cast<int>(i));
+                }
+                bench::keep(stack.top());
+            }
+        });
+        std::printf("%10zu %14.2f %14.2f %14.2f\n", n, vector * 1e9 / ops,
+                    growable * 1e9 / ops, fixed * 1e9 / ops);
+    }
+    return 0;
+}
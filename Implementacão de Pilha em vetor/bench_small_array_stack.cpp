@@ -0,0 +1,60 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_small_array_stack.cpp
+///
+/// Alocações e tempo por pilha de vida curta: SmallArrayStack<int, 32>
+/// contra a ArrayStack que cresce, com 8 a 128 elementos por pilha.
+///
+///     g++ -std=c++14 -O2 bench_small_array_stack.cpp -o bench_small
+#define BENCHMARK_COUNT_ALLOCATIONS
+
+#include "array_stack.h"
+#include "small_array_stack.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+
+namespace {
+
+/// Cria stacks pilhas, empilha e desempilha depth elementos em cada;
+/// devolve alocações por pilha e escreve os nanossegundos por pilha
+template<typename Make>
+double run(Make make, std::size_t stacks, int depth, double* ns) {
+    std::size_t before = bench::allocations().load();
+    double elapsed = bench::seconds([&] {
+        long sum = 0;
+        for (std::size_t s = 0; s < stacks; s++) {
+            auto stack = make();
+            for (int i = 0; i < depth; i++) {
+                stack.push(i);
+            }
+            while (!stack.empty()) {
+                sum += stack.pop();
+            }
+        }
+        bench::keep(sum);
+    }, 1);
+    *ns = elapsed * 1e9 / stacks;
+    return static_cast<double>(bench::allocations().load() - before) /
+           stacks;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t stacks = bench::scaled(2000000, bench::scale(argc, argv));
+
+    std::printf("%6s %18s %18s %18s %18s\n", "depth", "small allocs",
+                "array allocs", "small ns/stack", "array ns/stack");
+    for (int depth = 8; depth <= 128; depth *= 2) {
+        double small_ns, array_ns;
+        double small = run([] {
+            return structures::SmallArrayStack<int, 32>();
+        }, stacks, depth, &small_ns);
+        double array = run([] {
+            return structures::ArrayStack<int>(10u, true);
+        }, stacks, depth, &array_ns);
+        std::printf("%6d %18.2f %18.2f %18.1f %18.1f\n", depth, small, array,
+                    small_ns, array_ns);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_work_stealing_deque.cpp
+///
+/// Fork-join sobre WorkStealingDeque com 1 a N threads: cada tarefa de uma
+/// árvore binária completa gera as duas filhas no deque da própria thread,
+/// e as folhas fazem um pouco de conta. Threads ociosas roubam de outras.
+/// A linha "serial" faz o mesmo percurso com uma ArrayStack.
+///
+///     g++ -std=c++14 -O2 -pthread bench_work_stealing_deque.cpp -o bench
+#include "array_stack.h"
+#include "work_stealing_deque.h"
+#include "../benchmark.h"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Trabalho de uma folha
+long leaf(long seed) {
+    long x = seed;
+    for (int i = 0; i < 200; i++) {
+        x = x * 6364136223846793005L + 1442695040888963407L;
+    }
+    return x >> 33;
+}
+
+/// Percorre a árvore de profundidade depth com uma pilha só
+long serial(int depth) {
+    structures::ArrayStack<int> stack(10u, true);
+    long sum = 0;
+    stack.push(depth);
+    while (!stack.empty()) {
+        int task = stack.pop();
+        if (task == 0) {
+            sum += leaf(stack.size());
+        } else {
+            stack.push(task - 1);
+            stack.push(task - 1);
+        }
+    }
+    return sum;
+}
+
+/// Percorre a mesma árvore com threads threads roubando trabalho
+long fork_join(unsigned threads, int depth) {
+    std::vector<structures::WorkStealingDeque<int>> deques;
+    for (unsigned i = 0; i < threads; i++) {
+        deques.emplace_back();
+    }
+    // Tarefas criadas e ainda não terminadas.
+    std::atomic<long> pending{1};
+    std::atomic<long> total{0};
+    deques[0].push(depth);
+    bench::run_threads(threads, [&](unsigned id) {
+        auto& own = deques[id];
+        unsigned victim = id;
+        long sum = 0;
+        int task;
+        while (pending.load(std::memory_order_acquire) > 0) {
+            if (!own.try_pop(task)) {
+                victim = (victim + 1) % threads;
+                if (victim == id || !deques[victim].steal(task)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+            }
+            if (task == 0) {
+                sum += leaf(static_cast<long>(own.size()));
+            } else {
+                pending.fetch_add(2, std::memory_order_relaxed);
+                own.push(task - 1);
+                own.push(task - 1);
+            }
+            pending.fetch_sub(1, std::memory_order_release);
+        }
+        total.fetch_add(sum);
+    });
+    return total.load();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    double factor = bench::scale(argc, argv);
+    // 2^depth folhas; a escala tira ou põe níveis.
+    int depth = 20;
+    for (double f = factor; f < 1 && depth > 4; f *= 2) {
+        depth--;
+    }
+    double leaves = static_cast<double>(1L << depth);
+
+    double seconds = bench::seconds([&] { bench::keep(serial(depth)); });
+    std::printf("%8s %14s %10s\n", "threads", "ns/leaf", "speedup");
+    std::printf("%8s %14.2f %10.2f\n", "serial", seconds * 1e9 / leaves, 1.0);
+    for (auto threads : bench::thread_counts(bench::hardware_threads())) {
+        double elapsed = bench::seconds([&] {
+            bench::keep(fork_join(threads, depth));
+        });
+        std::printf("%8u %14.2f %10.2f\n", threads, elapsed * 1e9 / leaves,
+                    seconds / elapsed);
+    }
+    return 0;
+}
@@ -0,0 +1,276 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_SMALL_ARRAY_STACK_H
+#define STRUCTURES_SMALL_ARRAY_STACK_H
+
+#include <cstdint>  /// std::size_t
+#include <cstring>  /// std::memcpy
+#include <memory>  /// std::allocator
+#include <new>  /// placement new
+#include <stdexcept>  /// C++ exceptions
+#include <type_traits>  /// std::is_trivially_copyable
+#include <utility>  /// std::move, std::forward
+
+namespace structures {
+
+template<typename T, std::size_t N>
+/// Classe Pilha com os N primeiros elementos guardados no proprio objeto
+class SmallArrayStack {
+    static_assert(N > 0, "capacidade interna deve ser positiva");
+
+ public:
+    /// construtor simples
+    SmallArrayStack();
+    /// destrutor
+    ~SmallArrayStack();
+    /// copia nao suportada
+    SmallArrayStack(const SmallArrayStack&) = delete;
+    /// atribuicao nao suportada
+    SmallArrayStack& operator=(const SmallArrayStack&) = delete;
+    /// construtor por movimento: rouba o vetor externo ou move os elementos
+    /// internos um a um; other fica vazia
+    SmallArrayStack(SmallArrayStack&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+    /// atribuicao por movimento; other fica vazia
+    SmallArrayStack& operator=(SmallArrayStack&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+    /// metodo empilha
+    void push(const T& data);
+    /// metodo empilha movendo o dado
+    void push(T&& data);
+    /// metodo empilha construindo o dado no lugar
+    template<typename... Args>
+    T& emplace(Args&&... args);
+    /// metodo desempilha
+    T pop();
+    /// metodo retorna o topo
+    T& top();
+    /// metodo limpa pilha
+    void clear();
+    /// metodo retorna tamanho
+    std::size_t size();
+    /// metodo retorna capacidade atual
+    std::size_t max_size();
+    /// verifica se esta vazia
+    bool empty();
+    /// verifica se esta cheia (nunca, pois cresce)
+    bool full();
+    /// verifica se os elementos estao no buffer interno
+    bool is_inline();
+    /// garante capacidade para ao menos n elementos
+    void reserve(std::size_t n);
+    /// reduz a capacidade ao tamanho atual (volta ao buffer interno se couber)
+    void shrink_to_fit();
+
+ private:
+    /// move os elementos para um novo vetor
+    void reallocate(std::size_t new_size);
+    /// ponteiro para o buffer interno
+    T* inline_contents();
+    /// toma os elementos de other (esta pilha deve estar vazia e interna)
+    void steal(SmallArrayStack& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value);
+
+    alignas(T) unsigned char buffer_[N * sizeof(T)];
+    T* contents;
+    int top_;
+    std::size_t max_size_;
+
+    static const auto GROWTH_FACTOR = 2u;
+};
+
+}  // namespace structures
+
+template<typename T, std::size_t N>
+structures::SmallArrayStack<T, N>::SmallArrayStack() {
+    contents = inline_contents();
+    max_size_ = N;
+    top_ = -1;
+}
+
+template<typename T, std::size_t N>
+structures::SmallArrayStack<T, N>::~SmallArrayStack() {
+    clear();
+    if (!is_inline()) {
+        std::allocator<T>().deallocate(contents, max_size_);
+    }
+}
+
+template<typename T, std::size_t N>
+structures::SmallArrayStack<T, N>::SmallArrayStack(SmallArrayStack&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value) {
+    contents = inline_contents();
+    max_size_ = N;
+    top_ = -1;
+    steal(other);
+}
+
+template<typename T, std::size_t N>
+structures::SmallArrayStack<T, N>&
+structures::SmallArrayStack<T, N>::operator=(SmallArrayStack&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+        clear();
+        if (!is_inline()) {
+            std::allocator<T>().deallocate(contents, max_size_);
+        }
+        contents = inline_contents();
+        max_size_ = N;
+        steal(other);
+    }
+    return *this;
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayStack<T, N>::push(const T& data) {
+    emplace(data);
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayStack<T, N>::push(T&& data) {
+    emplace(std::move(data));
+}
+
+template<typename T, std::size_t N>
+template<typename... Args>
+T& structures::SmallArrayStack<T, N>::emplace(Args&&... args) {
+    if (size() == max_size_) {
+        // Constroi antes de realocar: args pode referenciar a propria pilha.
+        T value(std::forward<Args>(args)...);
+        reallocate(max_size_ * GROWTH_FACTOR);
+        T* slot = new (contents + top_ + 1) T(std::move(value));
+        top_++;
+        return *slot;
+    }
+    T* slot = new (contents + top_ + 1) T(std::forward<Args>(args)...);
+    top_++;
+    return *slot;
+}
+
+template<typename T, std::size_t N>
+T structures::SmallArrayStack<T, N>::pop() {
+    if (empty()) {
+        throw std::out_of_range("pilha vazia");
+    } else {
+        T data = std::move(contents[top_]);
+        contents[top_].~T();
+        top_--;
+        return data;
+    }
+}
+
+template<typename T, std::size_t N>
+T& structures::SmallArrayStack<T, N>::top() {
+    if (empty()) {
+        throw std::out_of_range("pilha vazia");
+    } else {
+        return contents[top_];
+    }
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayStack<T, N>::clear() {
+    while (top_ >= 0) {
+        contents[top_].~T();
+        top_--;
+    }
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::SmallArrayStack<T, N>::size() {
+    return (top_ + 1);
+}
+
+template<typename T, std::size_t N>
+std::size_t structures::SmallArrayStack<T, N>::max_size() {
+    return max_size_;
+}
+
+template<typename T, std::size_t N>
+bool structures::SmallArrayStack<T, N>::empty() {
+    return (top_ == -1);
+}
+
+template<typename T, std::size_t N>
+bool structures::SmallArrayStack<T, N>::full() {
+    return false;
+}
+
+template<typename T, std::size_t N>
+bool structures::SmallArrayStack<T, N>::is_inline() {
+    return (contents == inline_contents());
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayStack<T, N>::reserve(std::size_t n) {
+    if (n > max_size_) {
+        reallocate(n);
+    }
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayStack<T, N>::shrink_to_fit() {
+    if (!is_inline() && size() < max_size_) {
+        reallocate(size());
+    }
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayStack<T, N>::reallocate(std::size_t new_size) {
+    T* new_contents;
+    if (new_size <= N) {
+        // Cabe no buffer interno.
+        new_size = N;
+        new_contents = inline_contents();
+    } else {
+        new_contents = std::allocator<T>().allocate(new_size);
+    }
+    if (new_contents == contents) {
+        return;
+    }
+    std::size_t count = size();
+    if (std::is_trivially_copyable<T>::value) {
+        if (count > 0) {
+            std::memcpy(static_cast<void*>(new_contents),
+                        static_cast<const void*>(contents),
+                        count * sizeof(T));
+        }
+    } else {
+        for (std::size_t i = 0; i < count; i++) {
+            new (new_contents + i) T(std::move(contents[i]));
+            contents[i].~T();
+        }
+    }
+    if (!is_inline()) {
+        std::allocator<T>().deallocate(contents, max_size_);
+    }
+    contents = new_contents;
+    max_size_ = new_size;
+}
+
+template<typename T, std::size_t N>
+T* structures::SmallArrayStack<T, N>::inline_contents() {
+    return reinterpret_cast<T*>(buffer_);
+}
+
+template<typename T, std::size_t N>
+void structures::SmallArrayStack<T, N>::steal(SmallArrayStack& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value) {
+    if (other.is_inline()) {
+        // O buffer interno nao troca de dono: move elemento a elemento.
+        std::size_t count = other.size();
+        for (std::size_t i = 0; i < count; i++) {
+            new (contents + i) T(std::move(other.contents[i]));
+        }
+        top_ = other.top_;
+        other.clear();
+    } else {
+        contents = other.contents;
+        max_size_ = other.max_size_;
+        top_ = other.top_;
+        other.contents = other.inline_contents();
+        other.max_size_ = N;
+        other.top_ = -1;
+    }
+}
+
+#endif
@@ -4,8 +4,13 @@
 
 #include "gtest/gtest.h"
 #include "array_stack.h"
+#include "small_array_stack.h"
+#include "../tests_memory_resource.h"
 
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 int main(int argc, char* argv[]) {
     std::srand(std::time(NULL));
@@ -77,3 +82,143 @@ TEST_F(ArrayStackTest, PopFromEmptyStack) {
     ASSERT_THROW(stack.pop(), std::out_of_range);
 }
 
+TEST(ArrayStackGrowthTest, PushBeyondInitialSize) {
+    structures::ArrayStack<int> stack{2u, true};
+    for (auto i = 0; i < 100; ++i) {
+        stack.push(i);
+    }
+    ASSERT_EQ(100u, stack.size());
+    ASSERT_FALSE(stack.full());
+    ASSERT_LE(100u, stack.max_size());
+    for (auto i = 99; i >= 0; --i) {
+        ASSERT_EQ(i, stack.pop());
+    }
+}
+
+TEST(ArrayStackGrowthTest, GrowFromZero) {
+    structures::ArrayStack<std::string> stack{0u, true};
+    stack.push("a");
+    stack.push("b");
+    stack.push("c");
+    ASSERT_EQ("c", stack.pop());
+    ASSERT_EQ("b", stack.pop());
+    ASSERT_EQ("a", stack.top());
+}
+
+TEST(ArrayStackGrowthTest, ReserveAndShrink) {
+    structures::ArrayStack<int> stack{4u};
+    stack.reserve(64u);
+    ASSERT_EQ(64u, stack.max_size());
+    for (auto i = 0; i < 5; ++i) {
+        stack.push(i);
+    }
+    stack.shrink_to_fit();
+    ASSERT_EQ(5u, stack.max_size());
+    ASSERT_TRUE(stack.full());
+    ASSERT_EQ(4, stack.top());
+    ASSERT_THROW(stack.push(0), std::out_of_range);
+}
+
+TEST(ArrayStackGrowthTest, PushOwnTopWhenFull) {
+    structures::ArrayStack<std::string> stack{1u, true};
+    stack.push(std::string(100, 'x'));
+    stack.push(stack.top());
+    ASSERT_EQ(2u, stack.size());
+    ASSERT_EQ(std::string(100, 'x'), stack.pop());
+    ASSERT_EQ(std::string(100, 'x'), stack.pop());
+}
+
+TEST(SmallArrayStackTest, StaysInlineUpToCapacity) {
+    structures::SmallArrayStack<int, 32> stack;
+    for (auto i = 0; i < 32; ++i) {
+        stack.push(i);
+    }
+    ASSERT_TRUE(stack.is_inline());
+    ASSERT_EQ(32u, stack.size());
+    ASSERT_EQ(31, stack.top());
+}
+
+TEST(SmallArrayStackTest, PushOwnTopWhenFull) {
+    structures::SmallArrayStack<std::string, 1> stack;
+    stack.push(std::string(100, 'x'));
+    stack.push(stack.top());
+    ASSERT_FALSE(stack.is_inline());
+    ASSERT_EQ(std::string(100, 'x'), stack.pop());
+    ASSERT_EQ(std::string(100, 'x'), stack.pop());
+}
+
+TEST(SmallArrayStackTest, SpillsToHeapAndBack) {
+    structures::SmallArrayStack<std::string, 2> stack;
+    for (auto i = 0; i < 10; ++i) {
+        stack.push(std::to_string(i));
+    }
+    ASSERT_FALSE(stack.is_inline());
+    for (auto i = 9; i >= 1; --i) {
+        ASSERT_EQ(std::to_string(i), stack.pop());
+    }
+    stack.shrink_to_fit();
+    ASSERT_TRUE(stack.is_inline());
+    ASSERT_EQ("0", stack.top());
+    ASSERT_EQ("0", stack.pop());
+    ASSERT_THROW(stack.pop(), std::out_of_range);
+}
+
+TEST(SmallArrayStackTest, MoveInlineAndHeap) {
+    using Stack = structures::SmallArrayStack<std::string, 4>;
+    static_assert(std::is_nothrow_move_constructible<Stack>::value &&
+                  std::is_nothrow_move_assignable<Stack>::value,
+                  "movimento nao deve lancar");
+    // Internos: movidos um a um, a origem fica vazia e utilizavel.
+    Stack small;
+    for (auto i = 0; i < 3; ++i) {
+        small.push(std::string(32, 'a' + i));
+    }
+    Stack moved(std::move(small));
+    ASSERT_TRUE(moved.is_inline());
+    ASSERT_TRUE(small.empty());
+    ASSERT_EQ(3u, moved.size());
+    small.push("x");
+    ASSERT_EQ("x", small.pop());
+    // Externos: o vetor troca de dono.
+    Stack large;
+    for (auto i = 0; i < 10; ++i) {
+        large.push(std::to_string(i));
+    }
+    const std::string* data = &large.top();
+    moved = std::move(large);
+    ASSERT_FALSE(moved.is_inline());
+    ASSERT_EQ(data, &moved.top());
+    ASSERT_TRUE(large.empty());
+    ASSERT_TRUE(large.is_inline());
+    ASSERT_EQ(4u, large.max_size());
+    for (auto i = 9; i >= 0; --i) {
+        ASSERT_EQ(std::to_string(i), moved.pop());
+    }
+    // De volta para o buffer interno de um destino externo.
+    for (auto i = 0; i < 10; ++i) {
+        moved.push(std::to_string(i));
+    }
+    large.push("y");
+    moved = std::move(large);
+    ASSERT_TRUE(moved.is_inline());
+    ASSERT_EQ("y", moved.pop());
+    ASSERT_TRUE(moved.empty());
+}
+
+#if __cplusplus >= 201703L
+TEST(ArrayStackAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::ArrayStack<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(100, false, resource);
+        },
+        [](C& container, std::string value) {
+            container.push(std::move(value));
+        },
+        [](C& stack, int n) {
+            for (auto i = n - 1; i >= 0; --i) {
+                ASSERT_EQ(tests::long_value(i), stack.pop());
+            }
+        });
+}
+#endif
@@ -0,0 +1,117 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_work_stealing_deque.cpp
+
+#include "gtest/gtest.h"
+#include "work_stealing_deque.h"
+#include "work_stealing_deque.h"
+
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(WorkStealingDequeTest, OwnerPopsInStackOrder) {
+    structures::WorkStealingDeque<int> deque{2u};
+    for (auto i = 0; i < 100; ++i) {
+        deque.push(i);
+    }
+    ASSERT_EQ(100u, deque.size());
+    int data = -1;
+    for (auto i = 99; i >= 0; --i) {
+        ASSERT_TRUE(deque.try_pop(data));
+        ASSERT_EQ(i, data);
+    }
+    ASSERT_FALSE(deque.try_pop(data));
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(WorkStealingDequeTest, StealTakesOldest) {
+    structures::WorkStealingDeque<int> deque;
+    deque.push(1);
+    deque.push(2);
+    deque.push(3);
+    int data = 0;
+    ASSERT_TRUE(deque.steal(data));
+    ASSERT_EQ(1, data);
+    ASSERT_TRUE(deque.try_pop(data));
+    ASSERT_EQ(3, data);
+    ASSERT_TRUE(deque.steal(data));
+    ASSERT_EQ(2, data);
+    ASSERT_FALSE(deque.steal(data));
+    ASSERT_FALSE(deque.try_pop(data));
+}
+
+TEST(WorkStealingDequeTest, ConcurrentSteal) {
+    const int total = 100000;
+    const int thieves = 3;
+    structures::WorkStealingDeque<int> deque{4u};
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<int> taken{0};
+    std::vector<std::thread> workers;
+    for (auto t = 0; t < thieves; ++t) {
+        workers.emplace_back([&] {
+            int data;
+            while (taken.load() < total) {
+                if (deque.steal(data)) {
+                    seen[data].fetch_add(1);
+                    taken.fetch_add(1);
+                }
+            }
+        });
+    }
+    // O dono empilha e, de vez em quando, desempilha o que empilhou.
+    int data;
+    for (auto i = 0; i < total; ++i) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.try_pop(data)) {
+            seen[data].fetch_add(1);
+            taken.fetch_add(1);
+        }
+    }
+    while (deque.try_pop(data)) {
+        seen[data].fetch_add(1);
+        taken.fetch_add(1);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (auto& count : seen) {
+        ASSERT_EQ(1, count.load());
+    }
+}
+
+TEST(WorkStealingDequeTest, MoveTakesTheArray) {
+    using Deque = structures::WorkStealingDeque<int>;
+    static_assert(std::is_nothrow_move_constructible<Deque>::value &&
+                  std::is_nothrow_move_assignable<Deque>::value,
+                  "movimento nao deve lancar");
+    // Cresce antes de mover, para levar tambem os vetores antigos.
+    Deque deque{2u};
+    for (auto i = 0; i < 10; ++i) {
+        deque.push(i);
+    }
+    int data = -1;
+    ASSERT_TRUE(deque.steal(data));
+    ASSERT_EQ(0, data);
+    Deque moved(std::move(deque));
+    ASSERT_TRUE(deque.empty());
+    ASSERT_FALSE(deque.try_pop(data));
+    ASSERT_FALSE(deque.steal(data));
+    ASSERT_EQ(9u, moved.size());
+    ASSERT_TRUE(moved.steal(data));
+    ASSERT_EQ(1, data);
+    // O deque movido volta a funcionar.
+    deque.push(42);
+    ASSERT_EQ(1u, deque.size());
+    moved = std::move(deque);
+    ASSERT_TRUE(deque.empty());
+    ASSERT_TRUE(moved.try_pop(data));
+    ASSERT_EQ(42, data);
+    ASSERT_FALSE(moved.try_pop(data));
+}
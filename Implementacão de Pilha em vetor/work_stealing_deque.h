@@ -0,0 +1,237 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_WORK_STEALING_DEQUE_H
+#define STRUCTURES_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstdint>  /// std::size_t, std::int64_t
+#include <type_traits>  /// std::is_trivially_copyable
+#include <utility>  /// std::move
+#include <vector>
+
+namespace structures {
+
+template<typename T>
+/// Deque de roubo de trabalho (Chase-Lev): o dono empilha e desempilha
+/// pelo fundo, como numa ArrayStack, e outras threads roubam pelo topo.
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "elementos devem ser trivialmente copiaveis");
+
+ public:
+    /// construtor simples
+    WorkStealingDeque();
+    /// construtor com capacidade inicial (arredondada para potencia de 2)
+    explicit WorkStealingDeque(std::size_t max);
+    /// destrutor
+    ~WorkStealingDeque();
+    /// copia nao suportada
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    /// atribuicao nao suportada
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    /// construtor por movimento (sem acessos concorrentes): rouba o vetor;
+    /// other fica vazio e aloca de novo no proximo push
+    WorkStealingDeque(WorkStealingDeque&& other) noexcept;
+    /// atribuicao por movimento (sem acessos concorrentes a nenhum dos dois)
+    WorkStealingDeque& operator=(WorkStealingDeque&& other) noexcept;
+    /// metodo empilha no fundo (apenas o dono)
+    void push(const T& data);
+    /// metodo desempilha do fundo (apenas o dono); false se vazio
+    bool try_pop(T& data);
+    /// metodo rouba do topo (qualquer thread); false se vazio ou disputado
+    bool steal(T& data);
+    /// metodo retorna tamanho aproximado
+    std::size_t size() const;
+    /// verifica se esta vazio
+    bool empty() const;
+
+ private:
+    /// Vetor circular de capacidade potencia de 2
+    class Array {
+     public:
+        explicit Array(std::size_t capacity):
+            capacity_{capacity},
+            mask_{capacity - 1},
+            contents{new std::atomic<T>[capacity]}
+        {}
+        ~Array() {
+            delete [] contents;
+        }
+        std::size_t capacity() const {
+            return capacity_;
+        }
+        T get(std::int64_t index) const {
+            return contents[index & mask_].load(std::memory_order_relaxed);
+        }
+        void put(std::int64_t index, const T& data) {
+            contents[index & mask_].store(data, std::memory_order_relaxed);
+        }
+        /// Copia [top, bottom) para um vetor com o dobro da capacidade
+        Array* grow(std::int64_t top, std::int64_t bottom) const {
+            Array* bigger = new Array(capacity_ * 2);
+            for (std::int64_t i = top; i < bottom; i++) {
+                bigger->put(i, get(i));
+            }
+            return bigger;
+        }
+
+     private:
+        std::size_t capacity_;
+        std::size_t mask_;
+        std::atomic<T>* contents;
+    };
+
+    /// indice do topo (onde se rouba)
+    alignas(64) std::atomic<std::int64_t> top_;
+    /// indice do fundo (onde o dono trabalha)
+    alignas(64) std::atomic<std::int64_t> bottom_;
+    std::atomic<Array*> array_;
+    /// vetores antigos; liberados no destrutor pois ladroes podem le-los
+    std::vector<Array*> retired;
+
+    /// libera o vetor atual e os antigos
+    void release() noexcept;
+    /// toma os vetores de other, deixando-o vazio e sem vetor
+    void take(WorkStealingDeque& other) noexcept;
+
+    static const auto DEFAULT_SIZE = 16u;
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::WorkStealingDeque<T>::WorkStealingDeque():
+    WorkStealingDeque(DEFAULT_SIZE)
+{}
+
+template<typename T>
+structures::WorkStealingDeque<T>::WorkStealingDeque(std::size_t max) {
+    std::size_t capacity = 1;
+    while (capacity < max) {
+        capacity *= 2;
+    }
+    top_.store(0);
+    bottom_.store(0);
+    array_.store(new Array(capacity));
+}
+
+template<typename T>
+structures::WorkStealingDeque<T>::WorkStealingDeque(
+        WorkStealingDeque&& other) noexcept {
+    take(other);
+}
+
+template<typename T>
+structures::WorkStealingDeque<T>::~WorkStealingDeque() {
+    release();
+}
+
+template<typename T>
+structures::WorkStealingDeque<T>&
+structures::WorkStealingDeque<T>::operator=(WorkStealingDeque&& other)
+        noexcept {
+    if (this != &other) {
+        release();
+        take(other);
+    }
+    return *this;
+}
+
+template<typename T>
+void structures::WorkStealingDeque<T>::push(const T& data) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    Array* array = array_.load(std::memory_order_relaxed);
+    if (array == nullptr) {
+        // Deque movido: volta a ter vetor.
+        array = new Array(DEFAULT_SIZE);
+        array_.store(array, std::memory_order_release);
+    } else if (bottom - top >
+               static_cast<std::int64_t>(array->capacity()) - 1) {
+        // Cheio: dobra o vetor.
+        retired.push_back(array);
+        array = array->grow(top, bottom);
+        array_.store(array, std::memory_order_release);
+    }
+    array->put(bottom, data);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+}
+
+template<typename T>
+bool structures::WorkStealingDeque<T>::try_pop(T& data) {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* array = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+        // Vazio.
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+    data = array->get(bottom);
+    if (top == bottom) {
+        // Ultimo elemento: disputa com os ladroes.
+        bool won = top_.compare_exchange_strong(top, top + 1,
+                                                std::memory_order_seq_cst,
+                                                std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+template<typename T>
+bool structures::WorkStealingDeque<T>::steal(T& data) {
+    std::int64_t top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+        return false;
+    }
+    Array* array = array_.load(std::memory_order_acquire);
+    T value = array->get(top);
+    if (!top_.compare_exchange_strong(top, top + 1,
+                                      std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+        return false;
+    }
+    data = value;
+    return true;
+}
+
+template<typename T>
+std::size_t structures::WorkStealingDeque<T>::size() const {
+    std::int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    std::int64_t top = top_.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+}
+
+template<typename T>
+bool structures::WorkStealingDeque<T>::empty() const {
+    return (size() == 0);
+}
+
+template<typename T>
+void structures::WorkStealingDeque<T>::release() noexcept {
+    delete array_.load();
+    for (Array* old : retired) {
+        delete old;
+    }
+    retired.clear();
+}
+
+template<typename T>
+void structures::WorkStealingDeque<T>::take(WorkStealingDeque& other)
+        noexcept {
+    top_.store(other.top_.load());
+    bottom_.store(other.bottom_.load());
+    array_.store(other.array_.load());
+    retired = std::move(other.retired);
+    other.top_.store(0);
+    other.bottom_.store(0);
+    other.array_.store(nullptr);
+    other.retired.clear();
+}
+
+#endif
@@ -0,0 +1,104 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_blocking_linked_queue.cpp
+///
+/// Latência de entrega (p50/p99) sob carga leve: uma produtora envia um
+/// dado a cada ~50us e a consumidora mede quanto ele levou para chegar.
+/// BlockingLinkedQueue contra LinkedQueue com mutex lida por giro em
+/// empty(). Também mostra o tempo de CPU gasto pela consumidora.
+///
+///     g++ -std=c++14 -O2 -pthread bench_blocking_linked_queue.cpp -o bench
+#include "blocking_linked_queue.h"
+#include "linked_queue.h"
+#include "../benchmark.h"
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Instante atual em nanossegundos
+long long now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        bench::Clock::now().time_since_epoch()).count();
+}
+
+/// Tempo de CPU da thread atual em segundos (0 se indisponível)
+double thread_cpu() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+    return 0;
+#endif
+}
+
+/// Giro em empty() sobre uma LinkedQueue com mutex, como era feito
+class PolledQueue {
+ public:
+    void push(long long data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.enqueue(data);
+    }
+    void pop(long long& data) {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!queue.empty()) {
+                    data = queue.dequeue();
+                    return;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+ private:
+    std::mutex mutex;
+    structures::LinkedQueue<long long> queue;
+};
+
+/// Envia messages marcas de tempo e imprime p50/p99 da entrega
+template<typename Queue>
+void handoff(const char* name, std::size_t messages) {
+    Queue queue;
+    std::vector<double> latencies(messages);
+    double cpu = 0;
+    std::thread consumer([&] {
+        double start = thread_cpu();
+        for (std::size_t i = 0; i < messages; i++) {
+            long long stamp = 0;
+            queue.pop(stamp);
+            latencies[i] = static_cast<double>(now() - stamp);
+        }
+        cpu = thread_cpu() - start;
+    });
+    bench::Clock::time_point start = bench::Clock::now();
+    for (std::size_t i = 0; i < messages; i++) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+        queue.push(now());
+    }
+    consumer.join();
+    double wall = bench::since(start);
+    double p50 = bench::percentile(latencies, 0.50);
+    double p99 = bench::percentile(latencies, 0.99);
+    std::printf("%10s %10.2f %10.2f %12.1f%%\n", name, p50 / 1e3, p99 / 1e3,
+                100 * cpu / wall);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t messages = bench::scaled(20000, bench::scale(argc, argv));
+
+    std::printf("%10s %10s %10s %13s\n", "", "p50 us", "p99 us",
+                "consumer CPU");
+    handoff<structures::BlockingLinkedQueue<long long>>("blocking",
+                                                        messages);
+    handoff<PolledQueue>("spin-poll", messages);
+    return 0;
+}
@@ -0,0 +1,106 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_concurrent_linked_queue.cpp
+///
+/// ConcurrentLinkedQueue contra LinkedQueue protegida por std::mutex, com
+/// 1 a 32 threads (ou mais, se a máquina tiver) fazendo pares
+/// enqueue/dequeue: vazão e latência p50/p99 de um par, amostrada a cada
+/// 64 pares.
+///
+///     g++ -std=c++14 -O2 -pthread bench_concurrent_linked_queue.cpp -o bench
+#include "concurrent_linked_queue.h"
+#include "linked_queue.h"
+#include "../benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+/// LinkedQueue com um mutex em volta
+class LockedQueue {
+ public:
+    void enqueue(long data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.enqueue(data);
+    }
+    bool try_dequeue(long& data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.empty()) {
+            return false;
+        }
+        data = queue.dequeue();
+        return true;
+    }
+
+ private:
+    std::mutex mutex;
+    structures::LinkedQueue<long> queue;
+};
+
+/// Resultado de uma rodada
+struct Result {
+    double mops;
+    double p50_ns;
+    double p99_ns;
+};
+
+/// Rodada com threads threads de pairs pares cada
+template<typename Queue>
+Result contend(unsigned threads, std::size_t pairs) {
+    Queue queue;
+    std::vector<std::vector<double>> samples(threads);
+    double elapsed = bench::run_threads(threads, [&](unsigned id) {
+        auto& own = samples[id];
+        own.reserve(pairs / 64 + 1);
+        long sum = 0, data = 0;
+        for (std::size_t i = 0; i < pairs; i++) {
+            bool sample = i % 64 == 0;
+            bench::Clock::time_point start;
+            if (sample) {
+                start = bench::Clock::now();
+            }
+            queue.enqueue(static_cast<long>(i));
+            // Cada thread enfileira antes de desenfileirar: sempre há dado.
+            while (!queue.try_dequeue(data)) {}
+            sum += data;
+            if (sample) {
+                own.push_back(std::chrono::duration<double, std::nano>(
+                    bench::Clock::now() - start).count());
+            }
+        }
+        bench::keep(sum);
+    });
+    std::vector<double> all;
+    for (auto& own : samples) {
+        all.insert(all.end(), own.begin(), own.end());
+    }
+    Result result;
+    result.mops = 2.0 * threads * pairs / elapsed / 1e6;
+    result.p50_ns = bench::percentile(all, 0.50);
+    result.p99_ns = bench::percentile(all, 0.99);
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t total = bench::scaled(8000000, bench::scale(argc, argv));
+    unsigned max = std::max(32u, bench::hardware_threads());
+
+    std::printf("%8s %26s %26s\n", "", "lock-free", "mutex");
+    std::printf("%8s %8s %8s %8s %8s %8s %8s\n", "threads", "Mops/s",
+                "p50 ns", "p99 ns", "Mops/s", "p50 ns", "p99 ns");
+    for (auto threads : bench::thread_counts(max)) {
+        std::size_t pairs = std::max<std::size_t>(total / threads, 64);
+        Result lock_free =
+            contend<structures::ConcurrentLinkedQueue<long>>(threads, pairs);
+        Result locked = contend<LockedQueue>(threads, pairs);
+        std::printf("%8u %8.2f %8.0f %8.0f %8.2f %8.0f %8.0f\n", threads,
+                    lock_free.mops, lock_free.p50_ns, lock_free.p99_ns,
+                    locked.mops, locked.p50_ns, locked.p99_ns);
+    }
+    return 0;
+}
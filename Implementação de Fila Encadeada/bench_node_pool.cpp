@@ -0,0 +1,89 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_node_pool.cpp
+///
+/// Chamadas a operator new por operação e tempo por operação em regime:
+/// LinkedQueue e LinkedStack com 64 elementos, cada operação tira um e
+/// põe outro, com std::allocator e com NodePoolAllocator.
+///
+///     g++ -std=c++14 -O2 -pthread bench_node_pool.cpp -o bench
+#define BENCHMARK_COUNT_ALLOCATIONS
+
+#include "linked_queue.h"
+#include "node_pool.h"
+#include "../Implementação de Pilha Encadeada/linked_stack.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+
+namespace {
+
+const int DEPTH = 64;
+
+/// Enfileirar/desenfileirar
+struct QueueOps {
+    template<typename Queue>
+    static void put(Queue& queue, long data) {
+        queue.enqueue(data);
+    }
+    template<typename Queue>
+    static long take(Queue& queue) {
+        return queue.dequeue();
+    }
+};
+
+/// Empilhar/desempilhar
+struct StackOps {
+    template<typename Stack>
+    static void put(Stack& stack, long data) {
+        stack.push(data);
+    }
+    template<typename Stack>
+    static long take(Stack& stack) {
+        return stack.pop();
+    }
+};
+
+/// Imprime alocações e nanossegundos por operação, já em regime
+template<typename Container, typename Ops>
+void steady_state(const char* name, std::size_t ops) {
+    Container container;
+    for (int i = 0; i < DEPTH; i++) {
+        Ops::put(container, i);
+    }
+    // Aquece: a reserva já tem blocos na cache local.
+    for (int i = 0; i < DEPTH; i++) {
+        Ops::put(container, Ops::take(container));
+    }
+    std::size_t before = bench::allocations().load();
+    double seconds = bench::seconds([&] {
+        long sum = 0;
+        for (std::size_t i = 0; i < ops; i++) {
+            long data = Ops::take(container);
+            sum += data;
+            Ops::put(container, data + 1);
+        }
+        bench::keep(sum);
+    });
+    double allocations =
+        static_cast<double>(bench::allocations().load() - before) / (3 * ops);
+    std::printf("%-28s %14.4f %10.2f\n", name, allocations,
+                seconds * 1e9 / ops);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t ops = bench::scaled(20000000, bench::scale(argc, argv));
+
+    using Pool = structures::NodePoolAllocator<long>;
+    std::printf("%-28s %14s %10s\n", "", "allocs/op", "ns/op");
+    steady_state<structures::LinkedQueue<long>, QueueOps>(
+        "LinkedQueue", ops);
+    steady_state<structures::LinkedQueue<long, Pool>, QueueOps>(
+        "LinkedQueue + NodePool", ops);
+    steady_state<structures::LinkedStack<long>, StackOps>(
+        "LinkedStack", ops);
+    steady_state<structures::LinkedStack<long, Pool>, StackOps>(
+        "LinkedStack + NodePool", ops);
+    return 0;
+}
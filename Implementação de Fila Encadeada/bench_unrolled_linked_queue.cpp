@@ -0,0 +1,70 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_unrolled_linked_queue.cpp
+///
+/// UnrolledLinkedQueue contra LinkedQueue com int e ponteiro: bytes pedidos
+/// a operator new por elemento (e quantas chamadas) ao encher a fila com
+/// 1M elementos, e nanossegundos por elemento para encher e esvaziar.
+///
+///     g++ -std=c++14 -O2 bench_unrolled_linked_queue.cpp -o bench
+#define BENCHMARK_COUNT_ALLOCATIONS
+
+#include "linked_queue.h"
+#include "unrolled_linked_queue.h"
+#include "../benchmark.h"
+
+#include <cstdint>
+#include <cstdio>
+
+namespace {
+
+/// Imprime memória e tempo de Queue com n elementos
+template<typename Queue, typename T>
+void measure(const char* name, std::size_t n, std::size_t rounds) {
+    std::size_t calls = bench::allocations().load();
+    std::size_t bytes = bench::allocated_bytes().load();
+    {
+        Queue queue;
+        for (std::size_t i = 0; i < n; i++) {
+            queue.enqueue(T(i));
+        }
+        calls = bench::allocations().load() - calls;
+        bytes = bench::allocated_bytes().load() - bytes;
+    }
+    double seconds = bench::seconds([&] {
+        for (std::size_t r = 0; r < rounds; r++) {
+            Queue queue;
+            for (std::size_t i = 0; i < n; i++) {
+                queue.enqueue(T(i));
+            }
+            T last = T();
+            while (!queue.empty()) {
+                last = queue.dequeue();
+            }
+            bench::keep(last);
+        }
+    });
+    std::printf("%-24s %12.2f %12.4f %12.2f\n", name,
+                static_cast<double>(bytes) / n,
+                static_cast<double>(calls) / n,
+                seconds * 1e9 / (rounds * n));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t n = 1000000;
+    std::size_t rounds = bench::scaled(20, bench::scale(argc, argv));
+
+    using Pointer = std::uintptr_t;  // mesmo tamanho de um ponteiro
+    std::printf("%-24s %12s %12s %12s\n", "", "bytes/el", "allocs/el",
+                "ns/el");
+    measure<structures::LinkedQueue<int>, int>("LinkedQueue<int>", n,
+                                                rounds);
+    measure<structures::UnrolledLinkedQueue<int>, int>(
+        "Unrolled<int>", n, rounds);
+    measure<structures::LinkedQueue<Pointer>, Pointer>(
+        "LinkedQueue<pointer>", n, rounds);
+    measure<structures::UnrolledLinkedQueue<Pointer>, Pointer>(
+        "Unrolled<pointer>", n, rounds);
+    return 0;
+}
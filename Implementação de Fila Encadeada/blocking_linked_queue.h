@@ -0,0 +1,266 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_BLOCKING_LINKED_QUEUE_H
+#define STRUCTURES_BLOCKING_LINKED_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>  /// std::this_thread::yield
+#include <utility>  /// std::move
+
+#include "linked_queue.h"
+
+namespace structures {
+
+/// Fila encadeada bloqueante para produtores e consumidores, com
+/// capacidade opcional e encerramento
+template<typename T>
+class BlockingLinkedQueue {
+ public:
+    /// Construtor padrão (sem limite de tamanho)
+    BlockingLinkedQueue();
+    /// Construtor com capacidade máxima
+    explicit BlockingLinkedQueue(std::size_t max);
+    /// Enfileirar; espera enquanto cheia. false se a fila foi fechada
+    bool push(const T& data);
+    /// Enfileirar movendo o dado; espera enquanto cheia
+    bool push(T&& data);
+    /// Enfileirar sem esperar. false se cheia ou fechada
+    bool try_push(const T& data);
+    /// Enfileirar movendo o dado, sem esperar; data só é movido se entrar
+    bool try_push(T&& data);
+    /// Desenfileirar; espera por um dado. false se fechada e vazia
+    bool pop(T& data);
+    /// Desenfileirar esperando no máximo timeout. false se expirou
+    template<typename Rep, typename Period>
+    bool pop(T& data, const std::chrono::duration<Rep, Period>& timeout);
+    /// Desenfileirar sem esperar. false se vazia
+    bool try_pop(T& data);
+    /// Fecha a fila: acorda todos que esperam e recusa novos dados
+    void close();
+    /// Fila fechada
+    bool closed() const;
+    /// Fila vazia
+    bool empty() const;
+    /// Tamanho
+    std::size_t size() const;
+    /// Capacidade máxima
+    std::size_t max_size() const;
+
+ private:
+    /// Gira por pouco tempo antes de dormir, no máximo até deadline; o
+    /// limite spins se adapta ao sucesso
+    template<typename Predicate>
+    static bool spin(std::atomic<int>& spins, Predicate ready,
+                     std::chrono::steady_clock::time_point deadline =
+                         std::chrono::steady_clock::time_point::max());
+    /// Retira um dado com o mutex já travado
+    void take(T& data);
+
+    static const int MIN_SPINS = 16;
+    static const int MAX_SPINS = 4096;
+
+    LinkedQueue<T> queue;
+    mutable std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    /// Cópia do tamanho para consulta sem o mutex durante o giro
+    std::atomic<std::size_t> size_{0};
+    std::atomic<bool> closed_{false};
+    /// Limites de giro separados: produtores que nunca esperam não fazem
+    /// consumidores ociosos girarem mais, e vice-versa
+    std::atomic<int> pop_spins_{MIN_SPINS};
+    std::atomic<int> push_spins_{MIN_SPINS};
+    std::size_t max_size_;
+    /// Threads dormindo; evita notificar quando não há ninguém esperando
+    std::size_t waiting_consumers{0};
+    std::size_t waiting_producers{0};
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::BlockingLinkedQueue<T>::BlockingLinkedQueue():
+    BlockingLinkedQueue(std::numeric_limits<std::size_t>::max())
+{}
+
+template<typename T>
+structures::BlockingLinkedQueue<T>::BlockingLinkedQueue(std::size_t max):
+    max_size_{max}
+{}
+
+template<typename T>
+bool structures::BlockingLinkedQueue<T>::push(const T& data) {
+    return push(T(data));
+}
+
+template<typename T>
+bool structures::BlockingLinkedQueue<T>::push(T&& data) {
+    spin(push_spins_, [this] {
+        return size_.load(std::memory_order_relaxed) < max_size_ ||
+               closed_.load(std::memory_order_relaxed);
+    });
+    std::unique_lock<std::mutex> lock(mutex);
+    while (queue.size() >= max_size_ && !closed_.load()) {
+        waiting_producers++;
+        not_full.wait(lock);
+        waiting_producers--;
+    }
+    if (closed_.load()) {
+        return false;
+    }
+    queue.enqueue(std::move(data));
+    size_.store(queue.size(), std::memory_order_relaxed);
+    if (waiting_consumers > 0) {
+        not_empty.notify_one();
+    }
+    return true;
+}
+
+template<typename T>
+bool structures::BlockingLinkedQueue<T>::try_push(const T& data) {
+    return try_push(T(data));
+}
+
+template<typename T>
+bool structures::BlockingLinkedQueue<T>::try_push(T&& data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (closed_.load() || queue.size() >= max_size_) {
+        return false;
+    }
+    queue.enqueue(std::move(data));
+    size_.store(queue.size(), std::memory_order_relaxed);
+    if (waiting_consumers > 0) {
+        not_empty.notify_one();
+    }
+    return true;
+}
+
+template<typename T>
+bool structures::BlockingLinkedQueue<T>::pop(T& data) {
+    spin(pop_spins_, [this] {
+        return size_.load(std::memory_order_relaxed) > 0 ||
+               closed_.load(std::memory_order_relaxed);
+    });
+    std::unique_lock<std::mutex> lock(mutex);
+    while (queue.empty() && !closed_.load()) {
+        waiting_consumers++;
+        not_empty.wait(lock);
+        waiting_consumers--;
+    }
+    if (queue.empty()) {
+        return false;
+    }
+    take(data);
+    return true;
+}
+
+template<typename T>
+template<typename Rep, typename Period>
+bool structures::BlockingLinkedQueue<T>::pop(
+        T& data, const std::chrono::duration<Rep, Period>& timeout) {
+    auto deadline = std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            timeout);
+    spin(pop_spins_, [this] {
+        return size_.load(std::memory_order_relaxed) > 0 ||
+               closed_.load(std::memory_order_relaxed);
+    }, deadline);
+    std::unique_lock<std::mutex> lock(mutex);
+    while (queue.empty() && !closed_.load()) {
+        waiting_consumers++;
+        std::cv_status status = not_empty.wait_until(lock, deadline);
+        waiting_consumers--;
+        if (status == std::cv_status::timeout) {
+            break;
+        }
+    }
+    if (queue.empty()) {
+        return false;
+    }
+    take(data);
+    return true;
+}
+
+template<typename T>
+bool structures::BlockingLinkedQueue<T>::try_pop(T& data) {
+    if (size_.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (queue.empty()) {
+        return false;
+    }
+    take(data);
+    return true;
+}
+
+template<typename T>
+void structures::BlockingLinkedQueue<T>::close() {
+    std::lock_guard<std::mutex> lock(mutex);
+    closed_.store(true);
+    not_empty.notify_all();
+    not_full.notify_all();
+}
+
+template<typename T>
+bool structures::BlockingLinkedQueue<T>::closed() const {
+    return closed_.load();
+}
+
+template<typename T>
+bool structures::BlockingLinkedQueue<T>::empty() const {
+    return (size() == 0);
+}
+
+template<typename T>
+std::size_t structures::BlockingLinkedQueue<T>::size() const {
+    return size_.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+std::size_t structures::BlockingLinkedQueue<T>::max_size() const {
+    return max_size_;
+}
+
+template<typename T>
+template<typename Predicate>
+bool structures::BlockingLinkedQueue<T>::spin(
+        std::atomic<int>& spins, Predicate ready,
+        std::chrono::steady_clock::time_point deadline) {
+    int limit = spins.load(std::memory_order_relaxed);
+    for (int i = 0; i < limit; i++) {
+        if (ready()) {
+            // Girar valeu a pena: permite girar mais da próxima vez.
+            if (limit < MAX_SPINS) {
+                spins.store(limit * 2, std::memory_order_relaxed);
+            }
+            return true;
+        }
+        if ((i & 63) == 0 &&
+            std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        if ((i & 63) == 63) {
+            std::this_thread::yield();
+        }
+    }
+    if (limit > MIN_SPINS) {
+        spins.store(limit / 2, std::memory_order_relaxed);
+    }
+    return false;
+}
+
+template<typename T>
+void structures::BlockingLinkedQueue<T>::take(T& data) {
+    data = queue.dequeue();
+    size_.store(queue.size(), std::memory_order_relaxed);
+    if (waiting_producers > 0) {
+        not_full.notify_one();
+    }
+}
+
+#endif
@@ -0,0 +1,199 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_CONCURRENT_LINKED_QUEUE_H
+#define STRUCTURES_CONCURRENT_LINKED_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <new>  // placement new
+#include <stdexcept>
+#include <utility>  // std::move
+
+#include "hazard_pointers.h"
+
+namespace structures {
+
+/// Fila encadeada lock-free (Michael-Scott) para vários produtores e
+/// consumidores, com nodo sentinela e ponteiros de risco
+template<typename T>
+class ConcurrentLinkedQueue {
+ public:
+    /// Construtor padrão
+    ConcurrentLinkedQueue();
+    /// Destrutor (não pode haver acessos concorrentes)
+    ~ConcurrentLinkedQueue();
+    /// Cópia não suportada
+    ConcurrentLinkedQueue(const ConcurrentLinkedQueue&) = delete;
+    /// Atribuição não suportada
+    ConcurrentLinkedQueue& operator=(const ConcurrentLinkedQueue&) = delete;
+    /// Limpar
+    void clear();
+    /// Enfilerar
+    void enqueue(const T& data);
+    /// Enfilerar movendo o dado
+    void enqueue(T&& data);
+    /// Desenfilerar
+    T dequeue();
+    /// Desenfilerar sem exceção; false se vazia
+    bool try_dequeue(T& data);
+    /// Fila vazia
+    bool empty() const;
+    /// Tamanho aproximado
+    std::size_t size() const;
+
+ private:
+    /// Elemento. O dado só é lido pela thread cujo CAS em head tornou o
+    /// nodo sentinela, então ela pode movê-lo para fora; ele é destruído
+    /// junto com o nodo.
+    class Node {
+     public:
+        /// Nodo sentinela inicial, sem dado
+        Node() {}
+        template<typename U>
+        explicit Node(U&& data):
+            has_data_{true} {
+            new (storage) T(std::forward<U>(data));
+        }
+        ~Node() {
+            if (has_data_) {
+                this->data().~T();
+            }
+        }
+        /// Getter: dado
+        T& data() {
+            return *reinterpret_cast<T*>(storage);
+        }
+
+        std::atomic<Node*> next{nullptr};
+
+     private:
+        alignas(T) unsigned char storage[sizeof(T)];
+        bool has_data_{false};
+    };
+
+    /// Enfilera um nodo já construído
+    void enqueue_node(Node* node);
+
+    /// Sentinela: o primeiro dado fica no nodo seguinte
+    alignas(64) std::atomic<Node*> head;
+    /// Último nodo (ou um anterior, se outro enqueue estiver no meio)
+    alignas(64) std::atomic<Node*> tail;
+    /// Tamanho
+    alignas(64) std::atomic<std::size_t> size_;
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::ConcurrentLinkedQueue<T>::ConcurrentLinkedQueue() {
+    Node* sentinel = new Node();
+    head.store(sentinel);
+    tail.store(sentinel);
+    size_.store(0);
+}
+
+template<typename T>
+structures::ConcurrentLinkedQueue<T>::~ConcurrentLinkedQueue() {
+    Node* current = head.load();
+    while (current != nullptr) {
+        Node* next = current->next.load();
+        delete current;
+        current = next;
+    }
+}
+
+template<typename T>
+void structures::ConcurrentLinkedQueue<T>::clear() {
+    T data;
+    while (try_dequeue(data)) {}
+}
+
+template<typename T>
+void structures::ConcurrentLinkedQueue<T>::enqueue(const T& data) {
+    enqueue_node(new Node(data));
+}
+
+template<typename T>
+void structures::ConcurrentLinkedQueue<T>::enqueue(T&& data) {
+    enqueue_node(new Node(std::move(data)));
+}
+
+template<typename T>
+T structures::ConcurrentLinkedQueue<T>::dequeue() {
+    T data;
+    if (!try_dequeue(data)) {
+        throw std::out_of_range("fila vazia");
+    }
+    return data;
+}
+
+template<typename T>
+bool structures::ConcurrentLinkedQueue<T>::try_dequeue(T& data) {
+    while (true) {
+        Node* first = HazardPointers::protect(0, head);
+        Node* last = tail.load();
+        Node* next = HazardPointers::protect(1, first->next);
+        if (first != head.load()) {
+            continue;
+        }
+        if (next == nullptr) {
+            HazardPointers::clear(0);
+            HazardPointers::clear(1);
+            return false;
+        }
+        if (first == last) {
+            // Tail ficou para trás: ajuda o enqueue em andamento.
+            tail.compare_exchange_strong(last, next);
+            continue;
+        }
+        if (head.compare_exchange_strong(first, next)) {
+            // next vira o sentinela; está protegido pelo slot 1 e só esta
+            // thread venceu o CAS, então o dado pode ser movido.
+            data = std::move(next->data());
+            HazardPointers::clear(0);
+            HazardPointers::clear(1);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            HazardPointers::retire(first);
+            return true;
+        }
+    }
+}
+
+template<typename T>
+bool structures::ConcurrentLinkedQueue<T>::empty() const {
+    Node* first = HazardPointers::protect(0, head);
+    bool result = (first->next.load() == nullptr);
+    HazardPointers::clear(0);
+    return result;
+}
+
+template<typename T>
+std::size_t structures::ConcurrentLinkedQueue<T>::size() const {
+    return size_.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+void structures::ConcurrentLinkedQueue<T>::enqueue_node(Node* node) {
+    // Conta antes de publicar o nodo: o try_dequeue que o retirar só
+    // decrementa depois, então size() nunca fica abaixo de zero.
+    size_.fetch_add(1, std::memory_order_relaxed);
+    while (true) {
+        Node* last = HazardPointers::protect(0, tail);
+        Node* next = last->next.load();
+        if (last != tail.load()) {
+            continue;
+        }
+        if (next != nullptr) {
+            // Tail ficou para trás: avança antes de tentar de novo.
+            tail.compare_exchange_strong(last, next);
+            continue;
+        }
+        Node* expected = nullptr;
+        if (last->next.compare_exchange_strong(expected, node)) {
+            tail.compare_exchange_strong(last, node);
+            HazardPointers::clear(0);
+            return;
+        }
+    }
+}
+
+#endif
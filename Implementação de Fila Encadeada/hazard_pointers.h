@@ -0,0 +1,4 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// Os ponteiros de risco são os mesmos da pilha encadeada; manter uma única
+/// cópia garante que as duas estruturas possam ser usadas juntas.
+#include "../Implementação de Pilha Encadeada/hazard_pointers.h"
@@ -0,0 +1,165 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_INTRUSIVE_QUEUE_H
+#define STRUCTURES_INTRUSIVE_QUEUE_H
+
+#include <cstdint>
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_base_of
+
+namespace structures {
+
+template<typename T, typename Tag>
+class IntrusiveQueue;
+
+/// Gancho de fila embutido no tipo do usuário (por herança), com um
+/// único ponteiro. Tag permite estar em várias filas ao mesmo tempo.
+template<typename Tag = void>
+class IntrusiveQueueHook {
+ public:
+    IntrusiveQueueHook() {}
+    /// A cópia nasce fora de qualquer fila
+    IntrusiveQueueHook(const IntrusiveQueueHook&) {}
+    /// Atribuir não muda o encadeamento
+    IntrusiveQueueHook& operator=(const IntrusiveQueueHook&) {
+        return *this;
+    }
+    /// Está em alguma fila
+    bool linked() const {
+        return next_ != nullptr;
+    }
+
+ private:
+    template<typename, typename>
+    friend class IntrusiveQueue;
+
+    /// O último da fila aponta para si mesmo; nullptr é fora da fila
+    IntrusiveQueueHook* next_{nullptr};
+};
+
+/// Fila encadeada intrusiva: enfilera objetos que já existem, sem alocar
+/// nem copiar. A fila não é dona dos objetos.
+template<typename T, typename Tag = void>
+class IntrusiveQueue {
+ public:
+    using Hook = IntrusiveQueueHook<Tag>;
+
+    /// Construtor padrão
+    IntrusiveQueue();
+    /// Destrutor (apenas desliga os elementos)
+    ~IntrusiveQueue();
+    /// Cópia não suportada
+    IntrusiveQueue(const IntrusiveQueue&) = delete;
+    /// Atribuição não suportada
+    IntrusiveQueue& operator=(const IntrusiveQueue&) = delete;
+    /// Desliga todos os elementos
+    void clear();
+    /// Enfilerar
+    void enqueue(T& data);
+    /// Desenfilerar
+    T& dequeue();
+    /// Primeiro dado
+    T& front() const;
+    /// Último dado
+    T& back() const;
+    /// Fila vazia
+    bool empty() const;
+    /// Tamanho
+    std::size_t size() const;
+
+ private:
+    static_assert(std::is_base_of<Hook, T>::value,
+                  "T precisa herdar de IntrusiveQueueHook<Tag>");
+
+    static T& owner(Hook* node) {
+        return *static_cast<T*>(node);
+    }
+
+    /// Primeiro da fila
+    Hook* head;
+    /// Último da fila
+    Hook* tail;
+    /// Tamanho
+    std::size_t size_;
+};
+
+}  // namespace structures
+
+template<typename T, typename Tag>
+structures::IntrusiveQueue<T, Tag>::IntrusiveQueue() {
+    head = nullptr;
+    tail = nullptr;
+    size_ = 0;
+}
+
+template<typename T, typename Tag>
+structures::IntrusiveQueue<T, Tag>::~IntrusiveQueue() {
+    clear();
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveQueue<T, Tag>::clear() {
+    while (size_ > 0) {
+        dequeue();
+    }
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveQueue<T, Tag>::enqueue(T& data) {
+    Hook* node = static_cast<Hook*>(&data);
+    if (node->linked()) {
+        throw std::invalid_argument("elemento ja esta em uma fila");
+    }
+    node->next_ = node;
+    if (empty()) {
+        head = node;
+    } else {
+        tail->next_ = node;
+    }
+    tail = node;
+    size_++;
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveQueue<T, Tag>::dequeue() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    }
+    Hook* node = head;
+    if (node == tail) {
+        head = nullptr;
+        tail = nullptr;
+    } else {
+        head = node->next_;
+    }
+    node->next_ = nullptr;
+    size_--;
+    return owner(node);
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveQueue<T, Tag>::front() const {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    }
+    return owner(head);
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveQueue<T, Tag>::back() const {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    }
+    return owner(tail);
+}
+
+template<typename T, typename Tag>
+bool structures::IntrusiveQueue<T, Tag>::empty() const {
+    return (size_ == 0);
+}
+
+template<typename T, typename Tag>
+std::size_t structures::IntrusiveQueue<T, Tag>::size() const {
+    return size_;
+}
+
+#endif
@@ -3,21 +3,42 @@
 #define STRUCTURES_LINKED_QUEUE_H
 
 #include <cstdint>
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>
+#include <type_traits>  // std::true_type, std::false_type
+#include <utility>  // std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
 
 namespace structures {
 
 /// Classe fila encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class LinkedQueue {
  public:
+    using allocator_type = Allocator;
+
     /// Construtor padrão
     LinkedQueue();
+    /// Construtor com alocador
+    explicit LinkedQueue(const Allocator& allocator);
+    /// Construtor de cópia: copia os nodos em O(n)
+    LinkedQueue(const LinkedQueue& other);
+    /// Construtor de movimento: toma os nodos e o alocador de other em O(1)
+    LinkedQueue(LinkedQueue&& other) noexcept;
     /// Destrutor
     ~LinkedQueue();
+    /// Atribuição por cópia; o alocador de cada fila não muda
+    LinkedQueue& operator=(const LinkedQueue& other);
+    /// Atribuição por movimento: O(1) se os nodos puderem trocar de dono
+    LinkedQueue& operator=(LinkedQueue&& other);
     /// Limpar
     void clear();
     /// Enfilerar
     void enqueue(const T& data);
+    /// Enfilerar movendo o dado
+    void enqueue(T&& data);
     /// Desenfilerar
     T dequeue();
     /// Primeiro dado
@@ -28,6 +49,8 @@ class LinkedQueue {
     bool empty() const;
     /// Tamanho
     std::size_t size() const;
+    /// Alocador dos nodos
+    Allocator get_allocator() const;
 
  private:
     /// Elemento
@@ -40,6 +63,10 @@ class LinkedQueue {
             data_{data},
             next_{next}
         {}
+        Node(T&& data, Node* next):
+            data_{std::move(data)},
+            next_{next}
+        {}
         /// Getter: dado
         T& data() {
             return data_;
@@ -65,6 +92,26 @@ class LinkedQueue {
         T data_;
         Node* next_{nullptr};
     };
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Aloca e constrói um nodo
+    template<typename U>
+    Node* create_node(U&& data, Node* next);
+    /// Destrói e libera um nodo
+    void destroy_node(Node* node);
+    /// Acrescenta cópias dos dados de other, na mesma ordem
+    void append(const LinkedQueue& other);
+    /// Toma os nodos de other, que fica vazia
+    void steal(LinkedQueue& other) noexcept;
+    /// Movimento quando o alocador acompanha os nodos
+    void move_assign(LinkedQueue& other, std::true_type);
+    /// Movimento quando o alocador fica: só toma os nodos se for igual
+    void move_assign(LinkedQueue& other, std::false_type);
+
+    /// Alocador de nodos
+    NodeAllocator allocator_;
     /// Nodo-cabeça
     Node* head;
     /// Nodo-fim
@@ -73,32 +120,95 @@ class LinkedQueue {
     std::size_t size_;
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Fila que aloca os nodos de um std::pmr::memory_resource
+template<typename T>
+using LinkedQueue =
+    structures::LinkedQueue<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
-#endif
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>::LinkedQueue() {
+    head = nullptr;
+    tail = nullptr;
+    size_ = 0;
+}
 
-template<typename T>
-structures::LinkedQueue<T>::LinkedQueue() {
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>::LinkedQueue(const Allocator& allocator):
+    allocator_{allocator} {
     head = nullptr;
     tail = nullptr;
     size_ = 0;
 }
 
-template<typename T>
-structures::LinkedQueue<T>::~LinkedQueue() {
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>::LinkedQueue(
+        const LinkedQueue& other):
+    allocator_{NodeTraits::select_on_container_copy_construction(
+        other.allocator_)} {
+    head = nullptr;
+    tail = nullptr;
+    size_ = 0;
+    try {
+        append(other);
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>::LinkedQueue(
+        LinkedQueue&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>::~LinkedQueue() {
     clear();
 }
 
-template<typename T>
-void structures::LinkedQueue<T>::clear() {
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>&
+structures::LinkedQueue<T, Allocator>::operator=(const LinkedQueue& other) {
+    if (this != &other) {
+        clear();
+        append(other);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::LinkedQueue<T, Allocator>&
+structures::LinkedQueue<T, Allocator>::operator=(LinkedQueue&& other) {
+    if (this != &other) {
+        move_assign(other, typename NodeTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::clear() {
     while (size_ > 0) {
         dequeue();
     }
 }
 
-template<typename T>
-void structures::LinkedQueue<T>::enqueue(const T& data) {
-    Node *new_value = new Node(data, tail);
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::enqueue(const T& data) {
+    enqueue(T(data));
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::enqueue(T&& data) {
+    Node *new_value = create_node(std::move(data), nullptr);
     if (new_value == nullptr) {
         throw std::out_of_range("fila cheia");
     }
@@ -111,22 +221,22 @@ void structures::LinkedQueue<T>::enqueue(const T& data) {
     size_++;
 }
 
-template<typename T>
-T structures::LinkedQueue<T>::dequeue() {
+template<typename T, typename Allocator>
+T structures::LinkedQueue<T, Allocator>::dequeue() {
     if (empty()) {
         throw std::out_of_range("fila vazia");
     } else {
         Node *eliminate = head;
-        T info_back = eliminate->data();
+        T info_back = std::move(eliminate->data());
         head = eliminate->next();
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-T& structures::LinkedQueue<T>::front() const {
+template<typename T, typename Allocator>
+T& structures::LinkedQueue<T, Allocator>::front() const {
     if (empty()) {
         throw std::out_of_range("fila vazia");
     } else {
@@ -134,8 +244,8 @@ T& structures::LinkedQueue<T>::front() const {
     }
 }
 
-template<typename T>
-T& structures::LinkedQueue<T>::back() const {
+template<typename T, typename Allocator>
+T& structures::LinkedQueue<T, Allocator>::back() const {
     if (empty()) {
         throw std::out_of_range("fila vazia");
     } else {
@@ -143,12 +253,77 @@ T& structures::LinkedQueue<T>::back() const {
     }
 }
 
-template<typename T>
-bool structures::LinkedQueue<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::LinkedQueue<T, Allocator>::empty() const {
     return (size_ == 0);
 }
 
-template<typename T>
-std::size_t structures::LinkedQueue<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::LinkedQueue<T, Allocator>::size() const {
     return size_;
 }
+
+template<typename T, typename Allocator>
+Allocator structures::LinkedQueue<T, Allocator>::get_allocator() const {
+    return Allocator(allocator_);
+}
+
+template<typename T, typename Allocator>
+template<typename U>
+typename structures::LinkedQueue<T, Allocator>::Node*
+structures::LinkedQueue<T, Allocator>::create_node(U&& data, Node* next) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, std::forward<U>(data), next);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::append(const LinkedQueue& other) {
+    for (const Node* node = other.head; node != nullptr; node = node->next()) {
+        enqueue(node->data());
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::steal(LinkedQueue& other) noexcept {
+    head = other.head;
+    tail = other.tail;
+    size_ = other.size_;
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.size_ = 0;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::move_assign(
+        LinkedQueue& other, std::true_type) {
+    clear();
+    allocator_ = std::move(other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedQueue<T, Allocator>::move_assign(
+        LinkedQueue& other, std::false_type) {
+    clear();
+    if (allocator_ == other.allocator_) {
+        steal(other);
+    } else {
+        // Nodos de outro alocador não podem ser liberados por este.
+        append(other);
+        other.clear();
+    }
+}
+
+#endif
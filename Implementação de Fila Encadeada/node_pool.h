@@ -0,0 +1,4 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// A reserva de nodos é a mesma da pilha encadeada; manter uma única cópia
+/// garante que as duas estruturas possam ser usadas juntas.
+#include "../Implementação de Pilha Encadeada/node_pool.h"
@@ -0,0 +1,132 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_blocking_linked_queue.cpp
+
+#include "gtest/gtest.h"
+#include "linked_queue.h"
+#include "blocking_linked_queue.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(BlockingLinkedQueueTest, PushAndPop) {
+    structures::BlockingLinkedQueue<std::string> queue;
+    std::string data("a");
+    ASSERT_TRUE(queue.push(data));
+    ASSERT_TRUE(queue.try_push("b"));
+    ASSERT_EQ(2u, queue.size());
+    ASSERT_TRUE(queue.pop(data));
+    ASSERT_EQ("a", data);
+    ASSERT_TRUE(queue.try_pop(data));
+    ASSERT_EQ("b", data);
+    ASSERT_FALSE(queue.try_pop(data));
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(BlockingLinkedQueueTest, MoveOnlyData) {
+    structures::BlockingLinkedQueue<std::unique_ptr<int>> queue{1u};
+    ASSERT_TRUE(queue.push(std::unique_ptr<int>(new int(1))));
+    std::unique_ptr<int> rejected(new int(2));
+    ASSERT_FALSE(queue.try_push(std::move(rejected)));
+    // Recusado, o dado continua com quem chamou.
+    ASSERT_NE(nullptr, rejected);
+    std::unique_ptr<int> data;
+    ASSERT_TRUE(queue.pop(data));
+    ASSERT_EQ(1, *data);
+    ASSERT_TRUE(queue.try_push(std::move(rejected)));
+    ASSERT_EQ(nullptr, rejected);
+}
+
+TEST(BlockingLinkedQueueTest, TryPushWhenFull) {
+    structures::BlockingLinkedQueue<int> queue{2u};
+    ASSERT_TRUE(queue.try_push(1));
+    ASSERT_TRUE(queue.try_push(2));
+    ASSERT_FALSE(queue.try_push(3));
+    ASSERT_EQ(2u, queue.size());
+}
+
+TEST(BlockingLinkedQueueTest, PopTimesOut) {
+    structures::BlockingLinkedQueue<int> queue;
+    int data = 0;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(queue.pop(data, std::chrono::milliseconds(20)));
+    ASSERT_GE(std::chrono::steady_clock::now() - start,
+              std::chrono::milliseconds(20));
+}
+
+TEST(BlockingLinkedQueueTest, ZeroTimeoutAfterManyPushes) {
+    structures::BlockingLinkedQueue<int> queue;
+    int data = 0;
+    // Pushes sem espera não podem aumentar o giro dos consumidores.
+    for (auto i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(queue.push(i));
+    }
+    for (auto i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(queue.pop(data, std::chrono::milliseconds(0)));
+        ASSERT_EQ(i, data);
+    }
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(queue.pop(data, std::chrono::microseconds(0)));
+    ASSERT_LT(std::chrono::steady_clock::now() - start,
+              std::chrono::milliseconds(10));
+}
+
+TEST(BlockingLinkedQueueTest, CloseWakesConsumers) {
+    structures::BlockingLinkedQueue<int> queue;
+    std::thread consumer([&queue] {
+        int data;
+        ASSERT_FALSE(queue.pop(data));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.close();
+    consumer.join();
+    ASSERT_TRUE(queue.closed());
+    ASSERT_FALSE(queue.push(1));
+}
+
+TEST(BlockingLinkedQueueTest, ProducersAndConsumers) {
+    const int producers = 4;
+    const int consumers = 4;
+    const int per_producer = 20000;
+    structures::BlockingLinkedQueue<int> queue{64u};
+    std::vector<long long> sums(consumers, 0);
+    std::vector<std::thread> threads;
+    for (auto c = 0; c < consumers; ++c) {
+        threads.emplace_back([&queue, &sums, c] {
+            int data;
+            while (queue.pop(data)) {
+                sums[c] += data;
+            }
+        });
+    }
+    std::vector<std::thread> producing;
+    for (auto p = 0; p < producers; ++p) {
+        producing.emplace_back([&queue, per_producer] {
+            for (auto i = 1; i <= per_producer; ++i) {
+                queue.push(i);
+            }
+        });
+    }
+    for (auto& thread : producing) {
+        thread.join();
+    }
+    while (!queue.empty()) {
+        std::this_thread::yield();
+    }
+    queue.close();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    long long total = 0;
+    for (auto sum : sums) {
+        total += sum;
+    }
+    ASSERT_EQ(producers * (per_producer * (per_producer + 1LL) / 2), total);
+}
@@ -0,0 +1,139 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_concurrent_linked_queue.cpp
+
+#include "gtest/gtest.h"
+#include "concurrent_linked_queue.h"
+#include "hazard_pointers.h"
+#include "../Implementação de Pilha Encadeada/concurrent_linked_stack.h"
+#include "concurrent_linked_queue.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(ConcurrentLinkedQueueTest, EnqueueAndDequeue) {
+    structures::ConcurrentLinkedQueue<std::string> queue;
+    ASSERT_TRUE(queue.empty());
+    queue.enqueue("a");
+    queue.enqueue(std::string("b"));
+    ASSERT_EQ(2u, queue.size());
+    ASSERT_EQ("a", queue.dequeue());
+    ASSERT_EQ("b", queue.dequeue());
+    ASSERT_TRUE(queue.empty());
+    std::string data;
+    ASSERT_FALSE(queue.try_dequeue(data));
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+}
+
+TEST(ConcurrentLinkedQueueTest, MoveOnlyData) {
+    structures::ConcurrentLinkedQueue<std::unique_ptr<int>> queue;
+    queue.enqueue(std::unique_ptr<int>(new int(1)));
+    queue.enqueue(std::unique_ptr<int>(new int(2)));
+    std::unique_ptr<int> data;
+    ASSERT_TRUE(queue.try_dequeue(data));
+    ASSERT_EQ(1, *data);
+    queue.clear();
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(0u, queue.size());
+}
+
+TEST(ConcurrentLinkedQueueTest, UsedWithConcurrentLinkedStack) {
+    structures::ConcurrentLinkedQueue<int> queue;
+    structures::ConcurrentLinkedStack<int> stack;
+    for (auto i = 0; i < 100; ++i) {
+        queue.enqueue(i);
+    }
+    int data;
+    while (queue.try_dequeue(data)) {
+        stack.push(data);
+    }
+    for (auto i = 99; i >= 0; --i) {
+        ASSERT_EQ(i, stack.pop());
+    }
+}
+
+TEST(ConcurrentLinkedQueueTest, ConcurrentProducersAndConsumers) {
+    const int threads = 4;
+    const int per_thread = 20000;
+    structures::ConcurrentLinkedQueue<std::unique_ptr<int>> queue;
+    std::vector<std::atomic<int>> seen(threads * per_thread);
+    std::atomic<int> consumed{0};
+    std::atomic<int> out_of_order{0};
+    std::vector<std::thread> workers;
+    for (auto t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (auto i = 0; i < per_thread; ++i) {
+                int data = t * per_thread + i;
+                queue.enqueue(std::unique_ptr<int>(new int(data)));
+            }
+        });
+        workers.emplace_back([&] {
+            // Cada consumidor vê os dados de um produtor em ordem.
+            std::vector<int> last(threads, -1);
+            std::unique_ptr<int> data;
+            while (consumed.load() < threads * per_thread) {
+                if (queue.try_dequeue(data)) {
+                    int producer = *data / per_thread;
+                    if (*data <= last[producer]) {
+                        out_of_order.fetch_add(1);
+                    }
+                    last[producer] = *data;
+                    seen[*data].fetch_add(1);
+                    consumed.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    ASSERT_EQ(0, out_of_order.load());
+    ASSERT_TRUE(queue.empty());
+    for (auto& count : seen) {
+        ASSERT_EQ(1, count.load());
+    }
+}
+
+TEST(ConcurrentLinkedQueueTest, SizeNeverWraps) {
+    // Consumidores tentam retirar logo que cada nodo é publicado.
+    const int threads = 4;
+    const int per_thread = 50000;
+    const std::size_t total = threads * per_thread;
+    structures::ConcurrentLinkedQueue<int> queue;
+    std::atomic<int> consumed{0};
+    std::atomic<std::size_t> largest{0};
+    std::vector<std::thread> workers;
+    for (auto t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (auto i = 0; i < per_thread; ++i) {
+                queue.enqueue(i);
+            }
+        });
+        workers.emplace_back([&] {
+            int data;
+            while (consumed.load() < threads * per_thread) {
+                if (queue.try_dequeue(data)) {
+                    consumed.fetch_add(1);
+                }
+                std::size_t size = queue.size();
+                std::size_t seen = largest.load();
+                while (size > seen &&
+                       !largest.compare_exchange_weak(seen, size)) {}
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    ASSERT_LE(largest.load(), total);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(0u, queue.size());
+}
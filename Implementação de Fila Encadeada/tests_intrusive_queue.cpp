@@ -0,0 +1,82 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_intrusive_queue.cpp
+
+#include "gtest/gtest.h"
+#include "intrusive_queue.h"
+#include "intrusive_queue.h"
+
+#include <stdexcept>
+
+namespace {
+
+struct Ready {};
+
+struct Task : structures::IntrusiveQueueHook<>,
+              structures::IntrusiveQueueHook<Ready> {
+    explicit Task(int id): id{id} {}
+    int id;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(IntrusiveQueueTest, Fifo) {
+    Task tasks[] = {Task{0}, Task{1}, Task{2}};
+    structures::IntrusiveQueue<Task> queue;
+    for (auto& task : tasks) {
+        queue.enqueue(task);
+    }
+    ASSERT_EQ(3u, queue.size());
+    ASSERT_EQ(&tasks[0], &queue.front());
+    ASSERT_EQ(&tasks[2], &queue.back());
+    for (auto i = 0; i < 3; ++i) {
+        ASSERT_EQ(i, queue.dequeue().id);
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+    ASSERT_THROW(queue.front(), std::out_of_range);
+    ASSERT_THROW(queue.back(), std::out_of_range);
+}
+
+TEST(IntrusiveQueueTest, RejectsLinkedElement) {
+    Task a{0};
+    structures::IntrusiveQueue<Task> q1, q2;
+    q1.enqueue(a);
+    ASSERT_THROW(q1.enqueue(a), std::invalid_argument);
+    ASSERT_THROW(q2.enqueue(a), std::invalid_argument);
+    ASSERT_EQ(1u, q1.size());
+    ASSERT_TRUE(q2.empty());
+    q1.dequeue();
+    q2.enqueue(a);
+    ASSERT_EQ(&a, &q2.front());
+}
+
+TEST(IntrusiveQueueTest, OneObjectInTwoQueuesByTag) {
+    Task a{0}, b{1};
+    structures::IntrusiveQueue<Task> all;
+    structures::IntrusiveQueue<Task, Ready> ready;
+    all.enqueue(a);
+    all.enqueue(b);
+    ready.enqueue(b);
+    ASSERT_EQ(&a, &all.dequeue());
+    ASSERT_EQ(&b, &ready.front());
+    ASSERT_EQ(&b, &all.front());
+}
+
+TEST(IntrusiveQueueTest, ClearUnlinks) {
+    Task a{0}, b{1};
+    {
+        structures::IntrusiveQueue<Task> queue;
+        queue.enqueue(a);
+        queue.enqueue(b);
+        queue.clear();
+        ASSERT_TRUE(queue.empty());
+        queue.enqueue(b);
+    }
+    ASSERT_FALSE(a.structures::IntrusiveQueueHook<>::linked());
+    ASSERT_FALSE(b.structures::IntrusiveQueueHook<>::linked());
+}
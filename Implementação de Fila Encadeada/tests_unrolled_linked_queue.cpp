@@ -0,0 +1,124 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_unrolled_linked_queue.cpp
+
+#include "gtest/gtest.h"
+#include "unrolled_linked_queue.h"
+#include "unrolled_linked_queue.h"
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(UnrolledLinkedQueueTest, FifoAcrossBlocks) {
+    structures::UnrolledLinkedQueue<int> queue;
+    // Vários blocos de 122 ints, esvaziados e reaproveitados.
+    for (auto round = 0; round < 3; ++round) {
+        for (auto i = 0; i < 1000; ++i) {
+            queue.enqueue(i);
+        }
+        ASSERT_EQ(1000u, queue.size());
+        ASSERT_EQ(0, queue.front());
+        ASSERT_EQ(999, queue.back());
+        for (auto i = 0; i < 1000; ++i) {
+            ASSERT_EQ(i, queue.dequeue());
+        }
+        ASSERT_TRUE(queue.empty());
+    }
+    ASSERT_THROW(queue.dequeue(), std::out_of_range);
+    ASSERT_THROW(queue.front(), std::out_of_range);
+    ASSERT_THROW(queue.back(), std::out_of_range);
+}
+
+TEST(UnrolledLinkedQueueTest, InterleavedEnqueueAndDequeue) {
+    structures::UnrolledLinkedQueue<std::string> queue;
+    auto next_in = 0;
+    auto next_out = 0;
+    for (auto i = 0; i < 5000; ++i) {
+        queue.emplace(std::to_string(next_in++));
+        if (i % 3 == 0) {
+            ASSERT_EQ(std::to_string(next_out++), queue.dequeue());
+        }
+    }
+    ASSERT_EQ(static_cast<std::size_t>(next_in - next_out), queue.size());
+    while (!queue.empty()) {
+        ASSERT_EQ(std::to_string(next_out++), queue.dequeue());
+    }
+}
+
+TEST(UnrolledLinkedQueueTest, LargeElementsOnePerBlock) {
+    struct Big {
+        char bytes[1024];
+        int value;
+    };
+    structures::UnrolledLinkedQueue<Big> queue;
+    for (auto i = 0; i < 10; ++i) {
+        Big big;
+        big.value = i;
+        queue.enqueue(big);
+    }
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, queue.dequeue().value);
+    }
+}
+
+TEST(UnrolledLinkedQueueTest, ClearDestroysElements) {
+    auto shared = std::make_shared<int>(0);
+    {
+        structures::UnrolledLinkedQueue<std::shared_ptr<int>> queue;
+        for (auto i = 0; i < 100; ++i) {
+            queue.enqueue(shared);
+        }
+        queue.clear();
+        ASSERT_EQ(1, shared.use_count());
+        queue.enqueue(shared);
+    }
+    ASSERT_EQ(1, shared.use_count());
+}
+
+TEST(UnrolledLinkedQueueTest, MoveStealsTheBlocks) {
+    using Queue = structures::UnrolledLinkedQueue<std::string>;
+    static_assert(std::is_nothrow_move_constructible<Queue>::value &&
+                  std::is_nothrow_move_assignable<Queue>::value,
+                  "movimento nao deve lancar");
+    Queue queue;
+    for (auto i = 0; i < 100; ++i) {
+        queue.enqueue(std::to_string(i));
+    }
+    const std::string* first = &queue.front();
+    Queue moved(std::move(queue));
+    ASSERT_EQ(first, &moved.front());
+    ASSERT_EQ(100u, moved.size());
+    ASSERT_TRUE(queue.empty());
+    ASSERT_THROW(queue.front(), std::out_of_range);
+    // A fila movida volta a alocar blocos.
+    queue.enqueue("x");
+    moved = std::move(queue);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(1u, moved.size());
+    ASSERT_EQ("x", moved.dequeue());
+    ASSERT_TRUE(moved.empty());
+}
+
+TEST(UnrolledLinkedQueueTest, BlocksAreCacheLineAligned) {
+    // Dado com alinhamento de linha de cache: só fica alinhado se o
+    // próprio bloco estiver, inclusive antes do C++17.
+    struct alignas(64) Line {
+        int value;
+    };
+    structures::UnrolledLinkedQueue<Line> queue;
+    for (auto i = 0; i < 50; ++i) {
+        queue.enqueue(Line{i});
+        ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(&queue.back()) % 64);
+    }
+    for (auto i = 0; i < 50; ++i) {
+        ASSERT_EQ(i, queue.dequeue().value);
+    }
+}
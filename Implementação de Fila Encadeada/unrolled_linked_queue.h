@@ -0,0 +1,266 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_UNROLLED_LINKED_QUEUE_H
+#define STRUCTURES_UNROLLED_LINKED_QUEUE_H
+
+#include <cstdint>
+#include <new>  // placement new, ::operator new
+#include <stdexcept>
+#include <utility>  // std::move, std::forward
+
+namespace structures {
+
+/// Fila encadeada desenrolada: cada nodo guarda um bloco de vários dados,
+/// com início e fim próprios, em vez de um único dado por nodo
+template<typename T>
+class UnrolledLinkedQueue {
+ public:
+    /// Construtor padrão
+    UnrolledLinkedQueue();
+    /// Destrutor
+    ~UnrolledLinkedQueue();
+    /// Cópia não suportada
+    UnrolledLinkedQueue(const UnrolledLinkedQueue&) = delete;
+    /// Atribuição não suportada
+    UnrolledLinkedQueue& operator=(const UnrolledLinkedQueue&) = delete;
+    /// Construtor por movimento: rouba os blocos; other fica vazia
+    UnrolledLinkedQueue(UnrolledLinkedQueue&& other) noexcept;
+    /// Atribuição por movimento: rouba os blocos; other fica vazia
+    UnrolledLinkedQueue& operator=(UnrolledLinkedQueue&& other) noexcept;
+    /// Limpar
+    void clear();
+    /// Enfilerar
+    void enqueue(const T& data);
+    /// Enfilerar movendo o dado
+    void enqueue(T&& data);
+    /// Enfilerar construindo o dado no lugar
+    template<typename... Args>
+    T& emplace(Args&&... args);
+    /// Desenfilerar
+    T dequeue();
+    /// Primeiro dado
+    T& front() const;
+    /// Último dado
+    T& back() const;
+    /// Fila vazia
+    bool empty() const;
+    /// Tamanho
+    std::size_t size() const;
+
+ private:
+    static const std::size_t CACHE_LINE = 64;
+    /// Bytes por bloco, cabeçalho incluso (múltiplo da linha de cache)
+    static const std::size_t BLOCK_BYTES = 8 * CACHE_LINE;
+    /// Cabeçalho do bloco: next, begin e end
+    static const std::size_t HEADER_BYTES =
+        sizeof(void*) + 2 * sizeof(std::size_t);
+    /// Dados por bloco: os que cabem em BLOCK_BYTES junto do cabeçalho
+    static const std::size_t CAPACITY =
+        sizeof(T) + HEADER_BYTES >= BLOCK_BYTES ?
+        1 : (BLOCK_BYTES - HEADER_BYTES) / sizeof(T);
+
+    /// Elemento: bloco de dados; válidos apenas em [begin, end). Começa
+    /// numa linha de cache e ocupa linhas inteiras.
+    struct alignas(CACHE_LINE) Block {
+        T* data() {
+            return reinterpret_cast<T*>(storage);
+        }
+        /// Respeita o alinhamento também antes do C++17: guarda o endereço
+        /// devolvido por ::operator new logo antes do bloco.
+        static void* operator new(std::size_t bytes) {
+            char* raw = static_cast<char*>(::operator new(bytes + CACHE_LINE));
+            std::size_t shift = CACHE_LINE -
+                reinterpret_cast<std::uintptr_t>(raw) % CACHE_LINE;
+            char* aligned = raw + shift;
+            reinterpret_cast<void**>(aligned)[-1] = raw;
+            return aligned;
+        }
+        static void operator delete(void* block) {
+            if (block != nullptr) {
+                ::operator delete(static_cast<void**>(block)[-1]);
+            }
+        }
+
+        Block* next{nullptr};
+        std::size_t begin{0};
+        std::size_t end{0};
+        alignas(T) unsigned char storage[CAPACITY * sizeof(T)];
+    };
+    static_assert(sizeof(Block) % CACHE_LINE == 0,
+                  "bloco deve ocupar linhas de cache inteiras");
+
+    /// Bloco novo ou reaproveitado
+    Block* acquire_block();
+    /// Guarda o bloco esvaziado para reuso
+    void recycle_block(Block* block);
+    /// Toma os blocos de other, deixando-a vazia e sem blocos
+    void steal(UnrolledLinkedQueue& other) noexcept;
+
+    /// Bloco do início
+    Block* head;
+    /// Bloco do fim
+    Block* tail;
+    /// Bloco vazio guardado para o próximo enqueue
+    Block* spare;
+    /// Tamanho
+    std::size_t size_;
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::UnrolledLinkedQueue<T>::UnrolledLinkedQueue() {
+    head = nullptr;
+    tail = nullptr;
+    spare = nullptr;
+    size_ = 0;
+}
+
+template<typename T>
+structures::UnrolledLinkedQueue<T>::UnrolledLinkedQueue(
+        UnrolledLinkedQueue&& other) noexcept {
+    steal(other);
+}
+
+template<typename T>
+structures::UnrolledLinkedQueue<T>::~UnrolledLinkedQueue() {
+    clear();
+    delete head;
+    delete spare;
+}
+
+template<typename T>
+structures::UnrolledLinkedQueue<T>&
+structures::UnrolledLinkedQueue<T>::operator=(UnrolledLinkedQueue&& other)
+        noexcept {
+    if (this != &other) {
+        clear();
+        delete head;
+        delete spare;
+        steal(other);
+    }
+    return *this;
+}
+
+template<typename T>
+void structures::UnrolledLinkedQueue<T>::clear() {
+    while (size_ > 0) {
+        dequeue();
+    }
+}
+
+template<typename T>
+void structures::UnrolledLinkedQueue<T>::enqueue(const T& data) {
+    emplace(data);
+}
+
+template<typename T>
+void structures::UnrolledLinkedQueue<T>::enqueue(T&& data) {
+    emplace(std::move(data));
+}
+
+template<typename T>
+template<typename... Args>
+T& structures::UnrolledLinkedQueue<T>::emplace(Args&&... args) {
+    if (tail == nullptr) {
+        head = tail = acquire_block();
+    } else if (tail->end == CAPACITY) {
+        Block* block = acquire_block();
+        tail->next = block;
+        tail = block;
+    }
+    T* slot = new (tail->data() + tail->end) T(std::forward<Args>(args)...);
+    tail->end++;
+    size_++;
+    return *slot;
+}
+
+template<typename T>
+T structures::UnrolledLinkedQueue<T>::dequeue() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        T* slot = head->data() + head->begin;
+        T info_back = std::move(*slot);
+        slot->~T();
+        head->begin++;
+        size_--;
+        if (head->begin == head->end) {
+            if (head == tail) {
+                // Único bloco esvaziado: reaproveita no lugar.
+                head->begin = 0;
+                head->end = 0;
+            } else {
+                Block* eliminate = head;
+                head = head->next;
+                recycle_block(eliminate);
+            }
+        }
+        return info_back;
+    }
+}
+
+template<typename T>
+T& structures::UnrolledLinkedQueue<T>::front() const {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        return head->data()[head->begin];
+    }
+}
+
+template<typename T>
+T& structures::UnrolledLinkedQueue<T>::back() const {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    } else {
+        return tail->data()[tail->end - 1];
+    }
+}
+
+template<typename T>
+bool structures::UnrolledLinkedQueue<T>::empty() const {
+    return (size_ == 0);
+}
+
+template<typename T>
+std::size_t structures::UnrolledLinkedQueue<T>::size() const {
+    return size_;
+}
+
+template<typename T>
+typename structures::UnrolledLinkedQueue<T>::Block*
+structures::UnrolledLinkedQueue<T>::acquire_block() {
+    if (spare != nullptr) {
+        Block* block = spare;
+        spare = nullptr;
+        return block;
+    }
+    return new Block;
+}
+
+template<typename T>
+void structures::UnrolledLinkedQueue<T>::recycle_block(Block* block) {
+    if (spare != nullptr) {
+        delete block;
+        return;
+    }
+    block->next = nullptr;
+    block->begin = 0;
+    block->end = 0;
+    spare = block;
+}
+
+template<typename T>
+void structures::UnrolledLinkedQueue<T>::steal(UnrolledLinkedQueue& other)
+        noexcept {
+    head = other.head;
+    tail = other.tail;
+    spare = other.spare;
+    size_ = other.size_;
+    other.head = nullptr;
+    other.tail = nullptr;
+    other.spare = nullptr;
+    other.size_ = 0;
+}
+
+#endif
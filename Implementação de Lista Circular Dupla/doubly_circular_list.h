@@ -2,18 +2,115 @@
 #ifndef STRUCTURES_DOUBLY_CIRCULAR_LIST_H
 #define STRUCTURES_DOUBLY_CIRCULAR_LIST_H
 
+#include <cstddef>  // std::ptrdiff_t
 #include <cstdint>
+#include <iterator>  // std::bidirectional_iterator_tag
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::conditional, std::true_type, std::false_type
+#include <utility>  // std::swap, std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
 
 
 namespace structures {
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class DoublyCircularList {
+    class Node;
+
  public:
+    using allocator_type = Allocator;
+
+    /// Iterador bidirecional; V é T ou const T. end() é a sentinela, então
+    /// --end() chega ao último sem tratar caso especial.
+    template<typename V>
+    class Iterator {
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename std::remove_const<V>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = V*;
+        using reference = V&;
+
+        Iterator() {}
+        /// iterator converte para const_iterator
+        template<typename W, typename = typename std::enable_if<
+            std::is_convertible<W*, V*>::value>::type>
+        Iterator(const Iterator<W>& other):
+            node_{other.node_}
+        {}
+
+        reference operator*() const {
+            return node_->data();
+        }
+        pointer operator->() const {
+            return &node_->data();
+        }
+        Iterator& operator++() {
+            node_ = node_->next();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator old = *this;
+            node_ = node_->next();
+            return old;
+        }
+        Iterator& operator--() {
+            node_ = node_->prev();
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator old = *this;
+            node_ = node_->prev();
+            return old;
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node_ == b.node_;
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node_ != b.node_;
+        }
+
+     private:
+        friend class DoublyCircularList;
+        template<typename>
+        friend class Iterator;
+        using NodePointer = typename std::conditional<
+            std::is_const<V>::value, const Node*, Node*>::type;
+
+        explicit Iterator(NodePointer node):
+            node_{node}
+        {}
+
+        NodePointer node_{nullptr};
+    };
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
     /// Construtor
     DoublyCircularList();
+    /// Construtor com alocador
+    explicit DoublyCircularList(const Allocator& allocator);
+    /// Construtor de cópia: copia os nodos em O(n)
+    DoublyCircularList(const DoublyCircularList& other);
+    /// Construtor de cópia alocando com allocator
+    DoublyCircularList(const DoublyCircularList& other,
+                       const Allocator& allocator);
+    /// Construtor de movimento: toma os nodos de other em O(1); other
+    /// fica com uma sentinela nova, do mesmo alocador
+    DoublyCircularList(DoublyCircularList&& other);
     /// Destrutor
     ~DoublyCircularList();
+    /// Atribuição por cópia; o alocador de cada lista não muda
+    DoublyCircularList& operator=(const DoublyCircularList& other);
+    /// Atribuição por movimento: O(1) se os nodos puderem trocar de dono
+    DoublyCircularList& operator=(DoublyCircularList&& other);
+    /// Troca o conteúdo com other em O(1)
+    void swap(DoublyCircularList& other) noexcept;
+    /// Alocador dos nodos
+    Allocator get_allocator() const;
     /// Limpar lista
     void clear();
     /// Insere no fim
@@ -44,6 +141,12 @@ class DoublyCircularList {
     std::size_t find(const T& data) const;
     /// Tamanho
     std::size_t size() const;
+    /// Primeiro elemento
+    iterator begin();
+    /// Depois do último elemento (a sentinela)
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
 
  private:
     /// Elemento
@@ -98,70 +201,162 @@ class DoublyCircularList {
 
      private:
         T data_;
-        Node* prev_;
-        Node* next_;
+        Node* prev_{nullptr};
+        Node* next_{nullptr};
     };
-    /// Sentinela
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Aloca e constrói um nodo
+    template<typename... Args>
+    Node* create_node(Args&&... args);
+    /// Destrói e libera um nodo
+    void destroy_node(Node* node);
+    /// Copia os dados de other, na mesma ordem, para a lista vazia
+    void append(const DoublyCircularList& other);
+    /// Troca sentinelas e nodos com other, sem mexer nos alocadores
+    void steal(DoublyCircularList& other) noexcept;
+    /// Movimento quando o alocador acompanha os nodos
+    void move_assign(DoublyCircularList& other, std::true_type);
+    /// Movimento quando o alocador fica: só toma os nodos se for igual
+    void move_assign(DoublyCircularList& other, std::false_type);
+    /// Troca os alocadores, se eles acompanham a troca
+    void swap_allocator(DoublyCircularList& other, std::true_type) noexcept;
+    void swap_allocator(DoublyCircularList& other, std::false_type) noexcept;
+
+    /// Alocador de nodos
+    NodeAllocator allocator_;
+    /// Sentinela: next() é o primeiro e prev() o último; vazia, aponta
+    /// para si mesma
     Node* head;
     /// Tamanho
     std::size_t size_;
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Lista circular dupla que aloca os nodos de um std::pmr::memory_resource
+template<typename T>
+using DoublyCircularList =
+    structures::DoublyCircularList<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
-#endif
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList():
+    DoublyCircularList(Allocator())
+{}
 
-template<typename T>
-structures::DoublyCircularList<T>::DoublyCircularList() {
-    head = new Node(0);
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList(
+        const Allocator& allocator):
+    allocator_{allocator} {
+    head = create_node(T());
+    head->prev(head);
+    head->next(head);
     size_ = 0;
 }
 
-template<typename T>
-structures::DoublyCircularList<T>::~DoublyCircularList() {
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList(
+        const DoublyCircularList& other):
+    DoublyCircularList(other, NodeTraits::select_on_container_copy_construction(
+        other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList(
+        const DoublyCircularList& other, const Allocator& allocator):
+    DoublyCircularList(allocator) {
+    append(other);
+}
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::DoublyCircularList(
+        DoublyCircularList&& other):
+    DoublyCircularList(other.get_allocator()) {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>::~DoublyCircularList() {
     clear();
-    delete head;
+    destroy_node(head);
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::clear() {
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>&
+structures::DoublyCircularList<T, Allocator>::operator=(
+        const DoublyCircularList& other) {
+    if (this != &other) {
+        DoublyCircularList copy(other, get_allocator());
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyCircularList<T, Allocator>&
+structures::DoublyCircularList<T, Allocator>::operator=(
+        DoublyCircularList&& other) {
+    if (this != &other) {
+        move_assign(other, typename NodeTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::swap(
+        DoublyCircularList& other) noexcept {
+    steal(other);
+    swap_allocator(other,
+                   typename NodeTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::DoublyCircularList<T, Allocator>::get_allocator() const {
+    return Allocator(allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::clear() {
     while (size_> 0) {
         pop_front();
     }
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::push_back(const T& data) {
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_back(const T& data) {
     insert(data, size_);
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::push_front(const T& data) {
-    Node *new_value = new Node(data);
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::push_front(const T& data) {
+    Node *new_value = create_node(data);
     if (new_value == nullptr) {
         throw std::out_of_range("lista cheia");
     } else {
-        if (empty()) {
-            new_value->next(head);
-            head->prev(new_value);
-        } else {
-            new_value->next(head->next());
-        }
+        new_value->next(head->next());
         new_value->prev(head);
+        head->next()->prev(new_value);
         head->next(new_value);
         size_++;
     }
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::insert(const T& data,
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert(const T& data,
                                                std::size_t index) {
     if (index > size_ || index < 0) {
         throw std::out_of_range("posicao invalida");
     } else if (index == 0) {
         push_front(data);
     } else {
-        Node *new_value = new Node(data);
+        Node *new_value = create_node(data);
         if (new_value == nullptr) {
             throw std::out_of_range("lista cheia");
         } else {
@@ -178,8 +373,9 @@ void structures::DoublyCircularList<T>::insert(const T& data,
     }
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::insert_sorted(const T& data) {
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::insert_sorted(
+        const T& data) {
     if (empty()) {
         push_front(data);
     } else {
@@ -197,8 +393,8 @@ void structures::DoublyCircularList<T>::insert_sorted(const T& data) {
     }
 }
 
-template<typename T>
-T structures::DoublyCircularList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop(std::size_t index) {
     if (index >= size_ || index < 0) {
         throw std::out_of_range("posicao invalida");
     } else if (index == 0) {
@@ -213,18 +409,18 @@ T structures::DoublyCircularList<T>::pop(std::size_t index) {
         previous->next(eliminate->next());
         eliminate->next()->prev(previous);
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-T structures::DoublyCircularList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop_back() {
     return pop(size_ - 1);
 }
 
-template<typename T>
-T structures::DoublyCircularList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::DoublyCircularList<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
@@ -233,28 +429,29 @@ T structures::DoublyCircularList<T>::pop_front() {
         head->next(eliminate->next());
         eliminate->next()->prev(head);
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-void structures::DoublyCircularList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::remove(const T& data) {
     pop(find(data));
 }
 
-template<typename T>
-bool structures::DoublyCircularList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::DoublyCircularList<T, Allocator>::empty() const {
     return (size_ == 0);
 }
 
-template<typename T>
-bool structures::DoublyCircularList<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::DoublyCircularList<T, Allocator>::contains(
+        const T& data) const {
     return (find(data) != size_);
 }
 
-template<typename T>
-T& structures::DoublyCircularList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::DoublyCircularList<T, Allocator>::at(std::size_t index) {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else if (index > size_ || index < 0) {
@@ -268,8 +465,9 @@ T& structures::DoublyCircularList<T>::at(std::size_t index) {
     }
 }
 
-template<typename T>
-const T& structures::DoublyCircularList<T>::at(std::size_t index) const {
+template<typename T, typename Allocator>
+const T& structures::DoublyCircularList<T, Allocator>::at(
+        std::size_t index) const {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else if (index > size_ || index < 0) {
@@ -283,8 +481,9 @@ const T& structures::DoublyCircularList<T>::at(std::size_t index) const {
     }
 }
 
-template<typename T>
-std::size_t structures::DoublyCircularList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::DoublyCircularList<T, Allocator>::find(
+        const T& data) const {
     Node* current = head->next();
     for (std::size_t i = 0; i < size_; i++) {
         if (data == current->data()) {
@@ -295,7 +494,108 @@ std::size_t structures::DoublyCircularList<T>::find(const T& data) const {
     return size_;
 }
 
-template<typename T>
-std::size_t structures::DoublyCircularList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::DoublyCircularList<T, Allocator>::size() const {
     return size_;
 }
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::iterator
+structures::DoublyCircularList<T, Allocator>::begin() {
+    return iterator(head->next());
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::iterator
+structures::DoublyCircularList<T, Allocator>::end() {
+    return iterator(head);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::const_iterator
+structures::DoublyCircularList<T, Allocator>::begin() const {
+    return const_iterator(head->next());
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyCircularList<T, Allocator>::const_iterator
+structures::DoublyCircularList<T, Allocator>::end() const {
+    return const_iterator(head);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::DoublyCircularList<T, Allocator>::Node*
+structures::DoublyCircularList<T, Allocator>::create_node(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::append(
+        const DoublyCircularList& other) {
+    // Encadeia pelo fim guardando o último nodo.
+    const Node* current = other.head->next();
+    Node* last = head;
+    for (std::size_t i = 0; i < other.size_; i++) {
+        Node* node = create_node(current->data(), last, head);
+        last->next(node);
+        head->prev(node);
+        last = node;
+        size_++;
+        current = current->next();
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::steal(
+        DoublyCircularList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(size_, other.size_);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::move_assign(
+        DoublyCircularList& other, std::true_type) {
+    // Vazia, esta lista entrega a other a sua sentinela e o seu alocador.
+    clear();
+    std::swap(allocator_, other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::move_assign(
+        DoublyCircularList& other, std::false_type) {
+    clear();
+    if (allocator_ == other.allocator_) {
+        steal(other);
+    } else {
+        // Nodos de outro alocador não podem ser liberados por este.
+        append(other);
+        other.clear();
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::swap_allocator(
+        DoublyCircularList& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyCircularList<T, Allocator>::swap_allocator(
+        DoublyCircularList&, std::false_type) noexcept {}
+
+#endif
@@ -0,0 +1,142 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_doubly_circular_list.cpp
+
+#include "gtest/gtest.h"
+#include "doubly_circular_list.h"
+#include "doubly_circular_list.h"
+#include "../tests_memory_resource.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#if __cplusplus >= 202002L
+// Os iteradores satisfazem o conceito de std::ranges esperado.
+static_assert(std::ranges::bidirectional_range<
+    structures::DoublyCircularList<int>>);
+static_assert(std::ranges::bidirectional_range<
+    const structures::DoublyCircularList<int>>);
+static_assert(!std::ranges::random_access_range<
+    structures::DoublyCircularList<int>>);
+#endif
+
+namespace {
+
+/// Percorre a lista de trás para frente a partir de end().
+template<typename T>
+std::vector<T> backwards(const structures::DoublyCircularList<T>& list) {
+    std::vector<T> result;
+    auto it = list.end();
+    while (it != list.begin()) {
+        result.push_back(*--it);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(DoublyCircularListIteratorTest, EmptyList) {
+    structures::DoublyCircularList<int> list;
+    ASSERT_TRUE(list.begin() == list.end());
+    list.push_front(1);
+    list.pop_front();
+    ASSERT_TRUE(list.begin() == list.end());
+    ASSERT_TRUE(--list.end() == list.end());
+}
+
+TEST(DoublyCircularListIteratorTest, RangeForAndDecrementFromEnd) {
+    structures::DoublyCircularList<int> list;
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    auto expected = 0;
+    for (auto value : list) {
+        ASSERT_EQ(expected++, value);
+    }
+    ASSERT_EQ(10, expected);
+    ASSERT_EQ(9, *--list.end());
+    for (auto& value : list) {
+        value *= 10;
+    }
+    ASSERT_EQ(90, list.at(9));
+}
+
+TEST(DoublyCircularListIteratorTest, PrevLinksAfterEveryOperation) {
+    structures::DoublyCircularList<int> list;
+    list.push_front(3);
+    list.push_front(1);
+    list.push_back(4);
+    list.insert(2, 1);
+    list.insert_sorted(0);
+    list.insert_sorted(5);
+    ASSERT_EQ((std::vector<int>{5, 4, 3, 2, 1, 0}), backwards(list));
+    list.pop_front();
+    list.pop_back();
+    list.pop(1);
+    list.remove(3);
+    ASSERT_EQ((std::vector<int>{4, 1}), backwards(list));
+}
+
+TEST(DoublyCircularListIteratorTest, StandardAlgorithms) {
+    structures::DoublyCircularList<std::string> list;
+    for (auto word : {"a", "b", "c", "d"}) {
+        list.push_back(word);
+    }
+    ASSERT_EQ(4, std::distance(list.begin(), list.end()));
+    auto it = std::find(list.begin(), list.end(), "c");
+    ASSERT_EQ(1u, it->size());
+    ASSERT_EQ("b", *std::prev(it));
+    std::reverse(list.begin(), list.end());
+    ASSERT_EQ((std::vector<std::string>{"a", "b", "c", "d"}),
+              backwards(list));
+    ASSERT_EQ("dcba", std::accumulate(list.begin(), list.end(),
+                                      std::string()));
+
+    const auto& view = list;
+    structures::DoublyCircularList<std::string>::const_iterator first =
+        list.begin();
+    ASSERT_TRUE(first == view.begin());
+}
+
+TEST(DoublyCircularListIteratorTest, CopyAndMoveKeepLinks) {
+    structures::DoublyCircularList<int> list;
+    for (auto i = 0; i < 5; ++i) {
+        list.push_back(i);
+    }
+    structures::DoublyCircularList<int> copy(list);
+    ASSERT_EQ((std::vector<int>{4, 3, 2, 1, 0}), backwards(copy));
+    structures::DoublyCircularList<int> moved(std::move(list));
+    ASSERT_EQ((std::vector<int>{4, 3, 2, 1, 0}), backwards(moved));
+    ASSERT_TRUE(list.begin() == list.end());
+    list.push_front(7);
+    ASSERT_EQ(7, *--list.end());
+}
+
+#if __cplusplus >= 201703L
+TEST(DoublyCircularListAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::DoublyCircularList<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.push_back(std::move(value));
+        },
+        [](C& list, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_EQ(tests::long_value(i), list.at(i));
+            }
+        });
+}
+#endif
@@ -2,19 +2,104 @@
 #ifndef STRUCTURES_CIRCULAR_LIST_H
 #define STRUCTURES_CIRCULAR_LIST_H
 
+#include <cstddef>  // std::ptrdiff_t
 #include <cstdint>
-
+#include <iterator>  // std::forward_iterator_tag
+#include <memory>  // std::allocator, std::allocator_traits
+#include <type_traits>  // std::conditional, std::true_type, std::false_type
+#include <utility>  // std::swap, std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
 
 namespace structures {
 
 /// Classe lista circular
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class CircularList {
+    class Node;
+
  public:
+    using allocator_type = Allocator;
+
+    /// Iterador de avanço; V é T ou const T. Dá uma única volta, parando
+    /// no nodo cabeça.
+    template<typename V>
+    class Iterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::remove_const<V>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = V*;
+        using reference = V&;
+
+        Iterator() {}
+        /// iterator converte para const_iterator
+        template<typename W, typename = typename std::enable_if<
+            std::is_convertible<W*, V*>::value>::type>
+        Iterator(const Iterator<W>& other):
+            node_{other.node_}
+        {}
+
+        reference operator*() const {
+            return node_->data();
+        }
+        pointer operator->() const {
+            return &node_->data();
+        }
+        Iterator& operator++() {
+            node_ = node_->next();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator old = *this;
+            node_ = node_->next();
+            return old;
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node_ == b.node_;
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node_ != b.node_;
+        }
+
+     private:
+        friend class CircularList;
+        template<typename>
+        friend class Iterator;
+        using NodePointer = typename std::conditional<
+            std::is_const<V>::value, const Node*, Node*>::type;
+
+        explicit Iterator(NodePointer node):
+            node_{node}
+        {}
+
+        NodePointer node_{nullptr};
+    };
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
     /// Construtor
     CircularList();
+    /// Construtor com alocador
+    explicit CircularList(const Allocator& allocator);
+    /// Construtor de cópia: copia os nodos em O(n)
+    CircularList(const CircularList& other);
+    /// Construtor de cópia alocando com allocator
+    CircularList(const CircularList& other, const Allocator& allocator);
+    /// Construtor de movimento: toma os nodos de other em O(1); other
+    /// fica com uma sentinela nova, do mesmo alocador
+    CircularList(CircularList&& other);
     /// Destrutor
     ~CircularList();
+    /// Atribuição por cópia; o alocador de cada lista não muda
+    CircularList& operator=(const CircularList& other);
+    /// Atribuição por movimento: O(1) se os nodos puderem trocar de dono
+    CircularList& operator=(CircularList&& other);
+    /// Troca o conteúdo com other em O(1)
+    void swap(CircularList& other) noexcept;
+    /// Alocador dos nodos
+    Allocator get_allocator() const;
     /// Limpar lista
     void clear();
     /// Inserir no fim
@@ -45,6 +130,12 @@ class CircularList {
     std::size_t find(const T& data) const;
     /// Tamanho
     std::size_t size() const;
+    /// Primeiro elemento
+    iterator begin();
+    /// Depois do último elemento (o nodo cabeça)
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
 
  private:
     /// Elemento
@@ -83,43 +174,132 @@ class CircularList {
         T data_;
         Node* next_{nullptr};
     };
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Aloca e constrói um nodo
+    template<typename... Args>
+    Node* create_node(Args&&... args);
+    /// Destrói e libera um nodo
+    void destroy_node(Node* node);
+    /// Copia os dados de other, na mesma ordem, para a lista vazia
+    void append(const CircularList& other);
+    /// Troca sentinelas e nodos com other, sem mexer nos alocadores
+    void steal(CircularList& other) noexcept;
+    /// Movimento quando o alocador acompanha os nodos
+    void move_assign(CircularList& other, std::true_type);
+    /// Movimento quando o alocador fica: só toma os nodos se for igual
+    void move_assign(CircularList& other, std::false_type);
+    /// Troca os alocadores, se eles acompanham a troca
+    void swap_allocator(CircularList& other, std::true_type) noexcept;
+    void swap_allocator(CircularList& other, std::false_type) noexcept;
+
+    /// Alocador de nodos
+    NodeAllocator allocator_;
     /// Sentinela
     Node* head;
     /// Tamanho
     std::size_t size_;
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Lista circular que aloca os nodos de um std::pmr::memory_resource
+template<typename T>
+using CircularList =
+    structures::CircularList<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
-#endif
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList():
+    CircularList(Allocator())
+{}
 
-template<typename T>
-structures::CircularList<T>::CircularList() {
-    head = new Node(0);
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList(
+        const Allocator& allocator):
+    allocator_{allocator} {
+    head = create_node(T());
     size_ = 0;
 }
 
-template<typename T>
-structures::CircularList<T>::~CircularList() {
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList(const CircularList& other):
+    CircularList(other, NodeTraits::select_on_container_copy_construction(
+        other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList(
+        const CircularList& other, const Allocator& allocator):
+    CircularList(allocator) {
+    append(other);
+}
+
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::CircularList(CircularList&& other):
+    CircularList(other.get_allocator()) {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>::~CircularList() {
     clear();
-    delete head;
+    destroy_node(head);
 }
 
-template<typename T>
-void structures::CircularList<T>::clear() {
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>&
+structures::CircularList<T, Allocator>::operator=(const CircularList& other) {
+    if (this != &other) {
+        CircularList copy(other, get_allocator());
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::CircularList<T, Allocator>&
+structures::CircularList<T, Allocator>::operator=(CircularList&& other) {
+    if (this != &other) {
+        move_assign(other, typename NodeTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::swap(
+        CircularList& other) noexcept {
+    steal(other);
+    swap_allocator(other,
+                   typename NodeTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::CircularList<T, Allocator>::get_allocator() const {
+    return Allocator(allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::clear() {
     while (size_> 0) {
         pop_front();
     }
 }
 
-template<typename T>
-void structures::CircularList<T>::push_back(const T& data) {
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_back(const T& data) {
     insert(data, size_);
 }
 
-template<typename T>
-void structures::CircularList<T>::push_front(const T& data) {
-    Node *new_value = new Node(data);
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::push_front(const T& data) {
+    Node *new_value = create_node(data);
     if (new_value == nullptr) {
         throw std::out_of_range("lista cheia");
     } else {
@@ -133,14 +313,15 @@ void structures::CircularList<T>::push_front(const T& data) {
     }
 }
 
-template<typename T>
-void structures::CircularList<T>::insert(const T& data, std::size_t index) {
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert(const T& data,
+                                                    std::size_t index) {
     if (index > size_ || index < 0) {
         throw std::out_of_range("posicao invalida");
     } else if (index == 0) {
         push_front(data);
     } else {
-        Node *new_value = new Node(data);
+        Node *new_value = create_node(data);
         if (new_value == nullptr) {
             throw std::out_of_range("lista cheia");
         } else {
@@ -155,8 +336,8 @@ void structures::CircularList<T>::insert(const T& data, std::size_t index) {
     }
 }
 
-template<typename T>
-void structures::CircularList<T>::insert_sorted(const T& data) {
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::insert_sorted(const T& data) {
     if (empty()) {
         push_front(data);
     } else {
@@ -174,8 +355,8 @@ void structures::CircularList<T>::insert_sorted(const T& data) {
     }
 }
 
-template<typename T>
-T& structures::CircularList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::CircularList<T, Allocator>::at(std::size_t index) {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else if (index > size_ || index < 0) {
@@ -189,8 +370,8 @@ T& structures::CircularList<T>::at(std::size_t index) {
     }
 }
 
-template<typename T>
-const T& structures::CircularList<T>::at(std::size_t index) const {
+template<typename T, typename Allocator>
+const T& structures::CircularList<T, Allocator>::at(std::size_t index) const {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else if (index > size_ || index < 0) {
@@ -204,8 +385,8 @@ const T& structures::CircularList<T>::at(std::size_t index) const {
     }
 }
 
-template<typename T>
-T structures::CircularList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop(std::size_t index) {
     if (index >= size_ || index < 0) {
         throw std::out_of_range("posicao invalida");
     } else if (index == 0) {
@@ -219,18 +400,18 @@ T structures::CircularList<T>::pop(std::size_t index) {
         T info_back = eliminate->data();
         previous->next(eliminate->next());
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-T structures::CircularList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop_back() {
     return pop(size_ - 1);
 }
 
-template<typename T>
-T structures::CircularList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::CircularList<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
@@ -238,28 +419,28 @@ T structures::CircularList<T>::pop_front() {
         T info_back = eliminate->data();
         head->next(eliminate->next());
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-void structures::CircularList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::remove(const T& data) {
     pop(find(data));
 }
 
-template<typename T>
-bool structures::CircularList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::CircularList<T, Allocator>::empty() const {
     return (size_ == 0);
 }
 
-template<typename T>
-bool structures::CircularList<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::CircularList<T, Allocator>::contains(const T& data) const {
     return (find(data) != size_);
 }
 
-template<typename T>
-std::size_t structures::CircularList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::CircularList<T, Allocator>::find(const T& data) const {
     Node* current = head->next();
     for (std::size_t i = 0; i < size_; i++) {
         if (data == current->data()) {
@@ -270,7 +451,104 @@ std::size_t structures::CircularList<T>::find(const T& data) const {
     return size_;
 }
 
-template<typename T>
-std::size_t structures::CircularList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::CircularList<T, Allocator>::size() const {
     return size_;
 }
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::iterator
+structures::CircularList<T, Allocator>::begin() {
+    return iterator(empty() ? head : head->next());
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::iterator
+structures::CircularList<T, Allocator>::end() {
+    return iterator(head);
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::const_iterator
+structures::CircularList<T, Allocator>::begin() const {
+    return const_iterator(empty() ? head : head->next());
+}
+
+template<typename T, typename Allocator>
+typename structures::CircularList<T, Allocator>::const_iterator
+structures::CircularList<T, Allocator>::end() const {
+    return const_iterator(head);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::CircularList<T, Allocator>::Node*
+structures::CircularList<T, Allocator>::create_node(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::append(const CircularList& other) {
+    // Encadeia pelo fim guardando o último nodo.
+    Node* last = head;
+    for (const T& data : other) {
+        Node* node = create_node(data, head);
+        last->next(node);
+        last = node;
+        size_++;
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::steal(
+        CircularList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(size_, other.size_);
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::move_assign(CircularList& other,
+                                                         std::true_type) {
+    // Vazia, esta lista entrega a other a sua sentinela e o seu alocador.
+    clear();
+    std::swap(allocator_, other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::move_assign(CircularList& other,
+                                                         std::false_type) {
+    clear();
+    if (allocator_ == other.allocator_) {
+        steal(other);
+    } else {
+        // Nodos de outro alocador não podem ser liberados por este.
+        append(other);
+        other.clear();
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::swap_allocator(
+        CircularList& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::CircularList<T, Allocator>::swap_allocator(
+        CircularList&, std::false_type) noexcept {}
+
+#endif
@@ -0,0 +1,88 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_circular_list.cpp
+
+#include "gtest/gtest.h"
+#include "circular_list.h"
+#include "circular_list.h"
+#include "../tests_memory_resource.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#if __cplusplus >= 202002L
+// Os iteradores satisfazem o conceito de std::ranges esperado.
+static_assert(std::ranges::forward_range<structures::CircularList<int>>);
+static_assert(std::ranges::forward_range<const structures::CircularList<int>>);
+static_assert(!std::ranges::bidirectional_range<structures::CircularList<int>>);
+#endif
+
+TEST(CircularListIteratorTest, EmptyList) {
+    structures::CircularList<int> list;
+    ASSERT_TRUE(list.begin() == list.end());
+    list.push_back(1);
+    list.pop_back();
+    ASSERT_TRUE(list.begin() == list.end());
+}
+
+TEST(CircularListIteratorTest, RangeForMakesOneLap) {
+    structures::CircularList<int> list;
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    auto expected = 0;
+    for (auto value : list) {
+        ASSERT_EQ(expected++, value);
+    }
+    ASSERT_EQ(10, expected);
+    for (auto& value : list) {
+        value += 1;
+    }
+    ASSERT_EQ(1, list.at(0));
+}
+
+TEST(CircularListIteratorTest, StandardAlgorithms) {
+    structures::CircularList<int> list;
+    for (auto value : {5, 3, 8, 1}) {
+        list.push_back(value);
+    }
+    ASSERT_EQ(4, std::distance(list.begin(), list.end()));
+    ASSERT_EQ(17, std::accumulate(list.begin(), list.end(), 0));
+    ASSERT_EQ(8, *std::max_element(list.begin(), list.end()));
+    ASSERT_TRUE(std::find(list.begin(), list.end(), 7) == list.end());
+
+    const auto& view = list;
+    structures::CircularList<int>::const_iterator first = list.begin();
+    ASSERT_TRUE(first == view.begin());
+    std::vector<int> copy(view.begin(), view.end());
+    ASSERT_EQ((std::vector<int>{5, 3, 8, 1}), copy);
+}
+
+#if __cplusplus >= 201703L
+TEST(CircularListAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::CircularList<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.push_back(std::move(value));
+        },
+        [](C& list, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_EQ(tests::long_value(i), list.at(i));
+            }
+        });
+}
+#endif
@@ -2,19 +2,115 @@
 #ifndef STRUCTURES_DOUBLY_LINKED_LIST_H
 #define STRUCTURES_DOUBLY_LINKED_LIST_H
 
+#include <cstddef>  // std::ptrdiff_t
 #include <cstdint>
-
+#include <iterator>  // std::bidirectional_iterator_tag
+#include <memory>  // std::allocator, std::allocator_traits
+#include <type_traits>  // std::conditional, std::true_type, std::false_type
+#include <utility>  // std::swap, std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
 
 namespace structures {
 
 /// Classe lista duplamente encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class DoublyLinkedList {
+    class Node;
+
  public:
+    using allocator_type = Allocator;
+
+    /// Iterador bidirecional; V é T ou const T
+    template<typename V>
+    class Iterator {
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = typename std::remove_const<V>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = V*;
+        using reference = V&;
+
+        Iterator() {}
+        /// iterator converte para const_iterator
+        template<typename W, typename = typename std::enable_if<
+            std::is_convertible<W*, V*>::value>::type>
+        Iterator(const Iterator<W>& other):
+            node_{other.node_},
+            list_{other.list_}
+        {}
+
+        reference operator*() const {
+            return node_->data();
+        }
+        pointer operator->() const {
+            return &node_->data();
+        }
+        Iterator& operator++() {
+            node_ = node_->next();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator old = *this;
+            node_ = node_->next();
+            return old;
+        }
+        /// A partir de end() volta ao último
+        Iterator& operator--() {
+            node_ = node_ != nullptr ? node_->prev() : list_->tail;
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node_ == b.node_;
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node_ != b.node_;
+        }
+
+     private:
+        friend class DoublyLinkedList;
+        template<typename>
+        friend class Iterator;
+        using NodePointer = typename std::conditional<
+            std::is_const<V>::value, const Node*, Node*>::type;
+
+        Iterator(NodePointer node, const DoublyLinkedList* list):
+            node_{node},
+            list_{list}
+        {}
+
+        NodePointer node_{nullptr};
+        const DoublyLinkedList* list_{nullptr};
+    };
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
     /// Construtor
     DoublyLinkedList();
+    /// Construtor com alocador
+    explicit DoublyLinkedList(const Allocator& allocator);
+    /// Construtor de cópia: copia os nodos em O(n)
+    DoublyLinkedList(const DoublyLinkedList& other);
+    /// Construtor de cópia alocando com allocator
+    DoublyLinkedList(const DoublyLinkedList& other, const Allocator& allocator);
+    /// Construtor de movimento: toma os nodos e o alocador de other em O(1)
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept;
     /// Destrutor
     ~DoublyLinkedList();
+    /// Atribuição por cópia; o alocador de cada lista não muda
+    DoublyLinkedList& operator=(const DoublyLinkedList& other);
+    /// Atribuição por movimento: O(1) se os nodos puderem trocar de dono
+    DoublyLinkedList& operator=(DoublyLinkedList&& other);
+    /// Troca o conteúdo com other em O(1)
+    void swap(DoublyLinkedList& other) noexcept;
+    /// Alocador dos nodos
+    Allocator get_allocator() const;
     void clear();
     /// Insere no fim
     void push_back(const T& data);
@@ -44,6 +140,12 @@ class DoublyLinkedList {
     std::size_t find(const T& data) const;
     /// Tamanho
     std::size_t size() const;
+    /// Primeiro elemento
+    iterator begin();
+    /// Depois do último elemento
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
 
  private:
     /// Elemento
@@ -98,9 +200,32 @@ class DoublyLinkedList {
 
      private:
         T data_;
-        Node* prev_;
-        Node* next_;
+        Node* prev_{nullptr};
+        Node* next_{nullptr};
     };
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Aloca e constrói um nodo
+    template<typename... Args>
+    Node* create_node(Args&&... args);
+    /// Destrói e libera um nodo
+    void destroy_node(Node* node);
+    /// Copia os dados de other, na mesma ordem, para a lista vazia
+    void append(const DoublyLinkedList& other);
+    /// Troca os nodos com other, sem mexer nos alocadores
+    void steal(DoublyLinkedList& other) noexcept;
+    /// Movimento quando o alocador acompanha os nodos
+    void move_assign(DoublyLinkedList& other, std::true_type);
+    /// Movimento quando o alocador fica: só toma os nodos se for igual
+    void move_assign(DoublyLinkedList& other, std::false_type);
+    /// Troca os alocadores, se eles acompanham a troca
+    void swap_allocator(DoublyLinkedList& other, std::true_type) noexcept;
+    void swap_allocator(DoublyLinkedList& other, std::false_type) noexcept;
+
+    /// Alocador de nodos
+    NodeAllocator allocator_;
     /// Primeiro da lista
     Node* head;
     /// último da lista
@@ -109,56 +234,134 @@ class DoublyLinkedList {
     std::size_t size_;
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Lista dupla que aloca os nodos de um std::pmr::memory_resource
+template<typename T>
+using DoublyLinkedList =
+    structures::DoublyLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
-#endif
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList() {
+    head = nullptr;
+    tail = nullptr;
+    size_ = 0;
+}
 
-template<typename T>
-structures::DoublyLinkedList<T>::DoublyLinkedList() {
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList(
+        const Allocator& allocator):
+    allocator_{allocator} {
     head = nullptr;
     tail = nullptr;
     size_ = 0;
 }
 
-template<typename T>
-structures::DoublyLinkedList<T>::~DoublyLinkedList() {
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList(
+        const DoublyLinkedList& other):
+    DoublyLinkedList(other, NodeTraits::select_on_container_copy_construction(
+        other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList(
+        const DoublyLinkedList& other, const Allocator& allocator):
+    DoublyLinkedList(allocator) {
+    append(other);
+}
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::DoublyLinkedList(
+        DoublyLinkedList&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    head = nullptr;
+    tail = nullptr;
+    size_ = 0;
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>::~DoublyLinkedList() {
     clear();
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::clear() {
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>&
+structures::DoublyLinkedList<T, Allocator>::operator=(
+        const DoublyLinkedList& other) {
+    if (this != &other) {
+        DoublyLinkedList copy(other, get_allocator());
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::DoublyLinkedList<T, Allocator>&
+structures::DoublyLinkedList<T, Allocator>::operator=(
+        DoublyLinkedList&& other) {
+    if (this != &other) {
+        move_assign(other, typename NodeTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::swap(
+        DoublyLinkedList& other) noexcept {
+    steal(other);
+    swap_allocator(other,
+                   typename NodeTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::DoublyLinkedList<T, Allocator>::get_allocator() const {
+    return Allocator(allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::clear() {
     while (size_ > 0) {
         pop_front();
     }
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::push_back(const T& data) {
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_back(const T& data) {
     insert(data, size_);
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::push_front(const T& data) {
-    Node *new_value = new Node(data, head);
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::push_front(const T& data) {
+    Node *new_value = create_node(data, head);
     if (new_value == nullptr) {
         throw std::out_of_range("lista cheia");
     } else {
         head = new_value;
         if (new_value->next() != nullptr) {
             new_value->next()->prev(new_value);
+        } else {
+            tail = new_value;
         }
         size_++;
     }
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::insert(const T& data, std::size_t index) {
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert(const T& data,
+                                                        std::size_t index) {
     if (index > size_ || index < 0) {
         throw std::out_of_range("posicao invalida");
     } else if (index == 0) {
         push_front(data);
     } else {
-        Node *new_value = new Node(data);
+        Node *new_value = create_node(data);
         if (new_value == nullptr) {
             throw std::out_of_range("lista cheia");
         } else {
@@ -169,6 +372,8 @@ void structures::DoublyLinkedList<T>::insert(const T& data, std::size_t index) {
             new_value->next(previous->next());
             if (new_value->next() != nullptr) {
                 new_value->next()->prev(new_value);
+            } else {
+                tail = new_value;
             }
             previous->next(new_value);
             new_value->prev(previous);
@@ -177,8 +382,8 @@ void structures::DoublyLinkedList<T>::insert(const T& data, std::size_t index) {
     }
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::insert_sorted(const T& data) {
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::insert_sorted(const T& data) {
     if (empty()) {
         push_front(data);
     } else {
@@ -196,8 +401,8 @@ void structures::DoublyLinkedList<T>::insert_sorted(const T& data) {
     }
 }
 
-template<typename T>
-T structures::DoublyLinkedList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop(std::size_t index) {
     if (index >= size_ || index < 0) {
         throw std::out_of_range("posicao invalida");
     } else if (index == 0) {
@@ -212,20 +417,22 @@ T structures::DoublyLinkedList<T>::pop(std::size_t index) {
         previous->next(eliminate->next());
         if (eliminate->next() != nullptr) {
             eliminate->next()->prev(previous);
+        } else {
+            tail = previous;
         }
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop_back() {
     return pop(size_ - 1);
 }
 
-template<typename T>
-T structures::DoublyLinkedList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::DoublyLinkedList<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
@@ -234,30 +441,32 @@ T structures::DoublyLinkedList<T>::pop_front() {
         head = eliminate->next();
         if (head != nullptr) {
             head->prev(nullptr);
+        } else {
+            tail = nullptr;
         }
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-void structures::DoublyLinkedList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::remove(const T& data) {
     pop(find(data));
 }
 
-template<typename T>
-bool structures::DoublyLinkedList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::DoublyLinkedList<T, Allocator>::empty() const {
     return (size_ == 0);
 }
 
-template<typename T>
-bool structures::DoublyLinkedList<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::DoublyLinkedList<T, Allocator>::contains(const T& data) const {
     return (find(data) != size_);
 }
 
-template<typename T>
-T& structures::DoublyLinkedList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::DoublyLinkedList<T, Allocator>::at(std::size_t index) {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else if (index > size_ || index < 0) {
@@ -271,8 +480,9 @@ T& structures::DoublyLinkedList<T>::at(std::size_t index) {
     }
 }
 
-template<typename T>
-const T& structures::DoublyLinkedList<T>::at(std::size_t index) const {
+template<typename T, typename Allocator>
+const T& structures::DoublyLinkedList<T, Allocator>::at(
+        std::size_t index) const {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else if (index > size_ || index < 0) {
@@ -286,8 +496,9 @@ const T& structures::DoublyLinkedList<T>::at(std::size_t index) const {
     }
 }
 
-template<typename T>
-std::size_t structures::DoublyLinkedList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::DoublyLinkedList<T, Allocator>::find(
+        const T& data) const {
     Node* current = head;
     for (std::size_t i = 0; i < size_; i++) {
         if (data == current->data()) {
@@ -298,7 +509,107 @@ std::size_t structures::DoublyLinkedList<T>::find(const T& data) const {
     return size_;
 }
 
-template<typename T>
-std::size_t structures::DoublyLinkedList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::DoublyLinkedList<T, Allocator>::size() const {
     return size_;
 }
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::iterator
+structures::DoublyLinkedList<T, Allocator>::begin() {
+    return iterator(head, this);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::iterator
+structures::DoublyLinkedList<T, Allocator>::end() {
+    return iterator(nullptr, this);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::const_iterator
+structures::DoublyLinkedList<T, Allocator>::begin() const {
+    return const_iterator(head, this);
+}
+
+template<typename T, typename Allocator>
+typename structures::DoublyLinkedList<T, Allocator>::const_iterator
+structures::DoublyLinkedList<T, Allocator>::end() const {
+    return const_iterator(nullptr, this);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::DoublyLinkedList<T, Allocator>::Node*
+structures::DoublyLinkedList<T, Allocator>::create_node(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::append(
+        const DoublyLinkedList& other) {
+    for (const T& data : other) {
+        Node* node = create_node(data, tail, nullptr);
+        if (tail == nullptr) {
+            head = node;
+        } else {
+            tail->next(node);
+        }
+        tail = node;
+        size_++;
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::steal(
+        DoublyLinkedList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(tail, other.tail);
+    std::swap(size_, other.size_);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::move_assign(
+        DoublyLinkedList& other, std::true_type) {
+    clear();
+    allocator_ = std::move(other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::move_assign(
+        DoublyLinkedList& other, std::false_type) {
+    clear();
+    if (allocator_ == other.allocator_) {
+        steal(other);
+    } else {
+        // Nodos de outro alocador não podem ser liberados por este.
+        append(other);
+        other.clear();
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::swap_allocator(
+        DoublyLinkedList& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::DoublyLinkedList<T, Allocator>::swap_allocator(
+        DoublyLinkedList&, std::false_type) noexcept {}
+
+#endif
@@ -0,0 +1,315 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_INTRUSIVE_LIST_H
+#define STRUCTURES_INTRUSIVE_LIST_H
+
+#include <cstdint>
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_base_of
+
+namespace structures {
+
+template<typename T, typename Tag>
+class IntrusiveList;
+
+/// Gancho embutido no tipo do usuário (por herança). Tag permite que um
+/// mesmo objeto esteja em várias listas, um gancho para cada.
+template<typename Tag = void>
+class IntrusiveListHook {
+ public:
+    IntrusiveListHook() {}
+    /// A cópia nasce desligada de qualquer lista
+    IntrusiveListHook(const IntrusiveListHook&) {}
+    /// Atribuir não muda os encadeamentos
+    IntrusiveListHook& operator=(const IntrusiveListHook&) {
+        return *this;
+    }
+    /// Está em alguma lista
+    bool linked() const {
+        return next_ != nullptr;
+    }
+
+ private:
+    template<typename, typename>
+    friend class IntrusiveList;
+
+    IntrusiveListHook* prev_{nullptr};
+    IntrusiveListHook* next_{nullptr};
+    /// Sentinela da lista dona; nullptr é fora de qualquer lista
+    IntrusiveListHook* list_{nullptr};
+};
+
+/// Lista duplamente encadeada intrusiva: liga objetos que já existem, sem
+/// alocar nem copiar. A lista não é dona dos objetos; eles devem viver
+/// enquanto estiverem ligados.
+template<typename T, typename Tag = void>
+class IntrusiveList {
+ public:
+    using Hook = IntrusiveListHook<Tag>;
+
+    /// Construtor
+    IntrusiveList();
+    /// Destrutor (apenas desliga os elementos)
+    ~IntrusiveList();
+    /// Cópia não suportada
+    IntrusiveList(const IntrusiveList&) = delete;
+    /// Atribuição não suportada
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+    /// Desliga todos os elementos
+    void clear();
+    /// Insere no fim
+    void push_back(T& data);
+    /// Insere no início
+    void push_front(T& data);
+    /// Insere na posição
+    void insert(T& data, std::size_t index);
+    /// Insere antes de um elemento desta lista em O(1)
+    void insert_before(T& position, T& data);
+    /// Retira da posição
+    T& pop(std::size_t index);
+    /// Retira do fim
+    T& pop_back();
+    /// Retira do início
+    T& pop_front();
+    /// Retira um elemento desta lista em O(1)
+    void remove(T& data);
+    /// Lista vazia
+    bool empty() const;
+    /// Contém (o próprio objeto, não um igual) em O(1)
+    bool contains(const T& data) const;
+    /// Acesso a um elemento (checando limites)
+    T& at(std::size_t index);
+    /// Getter constante a um elemento
+    const T& at(std::size_t index) const;
+    /// Primeiro elemento
+    T& front() const;
+    /// Último elemento
+    T& back() const;
+    /// Posição de um objeto
+    std::size_t find(const T& data) const;
+    /// Tamanho
+    std::size_t size() const;
+
+ private:
+    static_assert(std::is_base_of<Hook, T>::value,
+                  "T precisa herdar de IntrusiveListHook<Tag>");
+
+    static Hook* hook(T& data) {
+        return static_cast<Hook*>(&data);
+    }
+    static const Hook* hook(const T& data) {
+        return static_cast<const Hook*>(&data);
+    }
+    static T& owner(Hook* node) {
+        return *static_cast<T*>(node);
+    }
+    /// Gancho da posição (index == size_ é o sentinela)
+    Hook* node_at(std::size_t index) const;
+    /// Liga node antes de position
+    void link_before(Hook* position, Hook* node);
+    /// Desliga node
+    void unlink(Hook* node);
+    /// Gancho ligado a esta lista (e não a outra com a mesma Tag)
+    bool owns(const Hook* node) const {
+        return node->list_ == &sentinel;
+    }
+
+    /// Sentinela circular: next_ é o primeiro e prev_ o último
+    mutable Hook sentinel;
+    /// Tamanho
+    std::size_t size_;
+};
+
+}  // namespace structures
+
+template<typename T, typename Tag>
+structures::IntrusiveList<T, Tag>::IntrusiveList() {
+    sentinel.prev_ = &sentinel;
+    sentinel.next_ = &sentinel;
+    size_ = 0;
+}
+
+template<typename T, typename Tag>
+structures::IntrusiveList<T, Tag>::~IntrusiveList() {
+    clear();
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveList<T, Tag>::clear() {
+    Hook* current = sentinel.next_;
+    while (current != &sentinel) {
+        Hook* next = current->next_;
+        current->prev_ = nullptr;
+        current->next_ = nullptr;
+        current->list_ = nullptr;
+        current = next;
+    }
+    sentinel.prev_ = &sentinel;
+    sentinel.next_ = &sentinel;
+    size_ = 0;
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveList<T, Tag>::push_back(T& data) {
+    link_before(&sentinel, hook(data));
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveList<T, Tag>::push_front(T& data) {
+    link_before(sentinel.next_, hook(data));
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveList<T, Tag>::insert(T& data, std::size_t index) {
+    if (index > size_) {
+        throw std::out_of_range("posicao invalida");
+    }
+    link_before(node_at(index), hook(data));
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveList<T, Tag>::insert_before(T& position, T& data) {
+    if (!owns(hook(position))) {
+        throw std::invalid_argument("posicao fora da lista");
+    }
+    link_before(hook(position), hook(data));
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveList<T, Tag>::pop(std::size_t index) {
+    if (index >= size_) {
+        throw std::out_of_range("posicao invalida");
+    }
+    Hook* node = node_at(index);
+    unlink(node);
+    return owner(node);
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveList<T, Tag>::pop_back() {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    Hook* node = sentinel.prev_;
+    unlink(node);
+    return owner(node);
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveList<T, Tag>::pop_front() {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    Hook* node = sentinel.next_;
+    unlink(node);
+    return owner(node);
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveList<T, Tag>::remove(T& data) {
+    if (!owns(hook(data))) {
+        throw std::invalid_argument("elemento fora da lista");
+    }
+    unlink(hook(data));
+}
+
+template<typename T, typename Tag>
+bool structures::IntrusiveList<T, Tag>::empty() const {
+    return (size_ == 0);
+}
+
+template<typename T, typename Tag>
+bool structures::IntrusiveList<T, Tag>::contains(const T& data) const {
+    return owns(hook(data));
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveList<T, Tag>::at(std::size_t index) {
+    if (index >= size_) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return owner(node_at(index));
+}
+
+template<typename T, typename Tag>
+const T& structures::IntrusiveList<T, Tag>::at(std::size_t index) const {
+    if (index >= size_) {
+        throw std::out_of_range("posicao invalida");
+    }
+    return owner(node_at(index));
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveList<T, Tag>::front() const {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    return owner(sentinel.next_);
+}
+
+template<typename T, typename Tag>
+T& structures::IntrusiveList<T, Tag>::back() const {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    return owner(sentinel.prev_);
+}
+
+template<typename T, typename Tag>
+std::size_t structures::IntrusiveList<T, Tag>::find(const T& data) const {
+    const Hook* target = hook(data);
+    const Hook* current = sentinel.next_;
+    std::size_t index = 0;
+    while (current != &sentinel && current != target) {
+        current = current->next_;
+        index++;
+    }
+    return index;
+}
+
+template<typename T, typename Tag>
+std::size_t structures::IntrusiveList<T, Tag>::size() const {
+    return size_;
+}
+
+template<typename T, typename Tag>
+typename structures::IntrusiveList<T, Tag>::Hook*
+structures::IntrusiveList<T, Tag>::node_at(std::size_t index) const {
+    // Percorre pelo lado mais próximo.
+    Hook* current = &sentinel;
+    if (index < size_ / 2) {
+        for (std::size_t i = 0; i <= index; i++) {
+            current = current->next_;
+        }
+    } else {
+        for (std::size_t i = size_; i > index; i--) {
+            current = current->prev_;
+        }
+    }
+    return current;
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveList<T, Tag>::link_before(Hook* position,
+                                                    Hook* node) {
+    if (node->linked()) {
+        throw std::invalid_argument("elemento ja esta em uma lista");
+    }
+    node->prev_ = position->prev_;
+    node->next_ = position;
+    node->list_ = &sentinel;
+    position->prev_->next_ = node;
+    position->prev_ = node;
+    size_++;
+}
+
+template<typename T, typename Tag>
+void structures::IntrusiveList<T, Tag>::unlink(Hook* node) {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+    node->prev_ = nullptr;
+    node->next_ = nullptr;
+    node->list_ = nullptr;
+    size_--;
+}
+
+#endif
@@ -0,0 +1,96 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_doubly_linked_list.cpp
+
+#include "gtest/gtest.h"
+#include "doubly_linked_list.h"
+#include "doubly_linked_list.h"
+#include "../tests_memory_resource.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#if __cplusplus >= 202002L
+// Os iteradores satisfazem o conceito de std::ranges esperado.
+static_assert(std::ranges::bidirectional_range<
+    structures::DoublyLinkedList<int>>);
+static_assert(std::ranges::bidirectional_range<
+    const structures::DoublyLinkedList<int>>);
+static_assert(!std::ranges::random_access_range<
+    structures::DoublyLinkedList<int>>);
+#endif
+
+TEST(DoublyLinkedListIteratorTest, EmptyList) {
+    structures::DoublyLinkedList<int> list;
+    ASSERT_TRUE(list.begin() == list.end());
+}
+
+TEST(DoublyLinkedListIteratorTest, RangeForAndDecrementFromEnd) {
+    structures::DoublyLinkedList<int> list;
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    auto expected = 0;
+    for (auto value : list) {
+        ASSERT_EQ(expected++, value);
+    }
+    ASSERT_EQ(9, *--list.end());
+    list.pop_back();
+    list.push_front(-1);
+    ASSERT_EQ(8, *--list.end());
+    auto it = list.end();
+    for (auto i = 8; i >= -1; --i) {
+        ASSERT_EQ(i, *--it);
+    }
+    ASSERT_TRUE(it == list.begin());
+}
+
+TEST(DoublyLinkedListIteratorTest, StandardAlgorithms) {
+    structures::DoublyLinkedList<int> list;
+    for (auto value : {1, 2, 3, 4, 5}) {
+        list.push_back(value);
+    }
+    std::vector<int> backwards(std::reverse_iterator<
+        structures::DoublyLinkedList<int>::iterator>(list.end()),
+        std::reverse_iterator<
+        structures::DoublyLinkedList<int>::iterator>(list.begin()));
+    ASSERT_EQ((std::vector<int>{5, 4, 3, 2, 1}), backwards);
+
+    std::reverse(list.begin(), list.end());
+    ASSERT_EQ(5, list.at(0));
+    ASSERT_EQ(1, list.at(4));
+    ASSERT_EQ(5, std::distance(list.begin(), list.end()));
+
+    const auto& view = list;
+    structures::DoublyLinkedList<int>::const_iterator last = --list.end();
+    ASSERT_TRUE(last == --view.end());
+    ASSERT_EQ(1, *last);
+}
+
+#if __cplusplus >= 201703L
+TEST(DoublyLinkedListAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::DoublyLinkedList<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.push_back(std::move(value));
+        },
+        [](C& list, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_EQ(tests::long_value(i), list.at(i));
+            }
+        });
+}
+#endif
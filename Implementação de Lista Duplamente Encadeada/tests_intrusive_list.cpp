@@ -0,0 +1,120 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_intrusive_list.cpp
+
+#include "gtest/gtest.h"
+#include "intrusive_list.h"
+#include "intrusive_list.h"
+
+#include <stdexcept>
+
+namespace {
+
+struct ByAge {};
+
+struct Item : structures::IntrusiveListHook<>,
+              structures::IntrusiveListHook<ByAge> {
+    explicit Item(int value): value{value} {}
+    int value;
+};
+
+using List = structures::IntrusiveList<Item>;
+using AgeList = structures::IntrusiveList<Item, ByAge>;
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(IntrusiveListTest, PushPopAndPositions) {
+    Item a{0}, b{1}, c{2}, d{3};
+    List list;
+    list.push_back(b);
+    list.push_front(a);
+    list.push_back(d);
+    list.insert(c, 2);
+    ASSERT_EQ(4u, list.size());
+    for (auto i = 0; i < 4; ++i) {
+        ASSERT_EQ(i, list.at(i).value);
+    }
+    ASSERT_EQ(&a, &list.front());
+    ASSERT_EQ(&d, &list.back());
+    ASSERT_EQ(2u, list.find(c));
+    ASSERT_EQ(&c, &list.pop(2));
+    ASSERT_FALSE(c.structures::IntrusiveListHook<>::linked());
+    ASSERT_EQ(&d, &list.pop_back());
+    ASSERT_EQ(&a, &list.pop_front());
+    ASSERT_EQ(1u, list.size());
+    ASSERT_THROW(list.at(1), std::out_of_range);
+    ASSERT_THROW(list.insert(a, 3), std::out_of_range);
+}
+
+TEST(IntrusiveListTest, InsertBeforeAndRemove) {
+    Item a{0}, b{1}, c{2};
+    List list;
+    list.push_back(a);
+    list.push_back(c);
+    list.insert_before(c, b);
+    ASSERT_EQ(1, list.at(1).value);
+    list.remove(a);
+    ASSERT_EQ(2u, list.size());
+    ASSERT_FALSE(list.contains(a));
+    ASSERT_TRUE(list.contains(b));
+    ASSERT_THROW(list.remove(a), std::invalid_argument);
+    ASSERT_THROW(list.insert_before(a, a), std::invalid_argument);
+    ASSERT_THROW(list.push_back(b), std::invalid_argument);
+    list.clear();
+    ASSERT_TRUE(list.empty());
+    ASSERT_FALSE(b.structures::IntrusiveListHook<>::linked());
+}
+
+TEST(IntrusiveListTest, RejectsElementOfAnotherList) {
+    Item a{0}, b{1}, c{2};
+    List l1, l2;
+    l1.push_back(a);
+    l1.push_back(b);
+    l2.push_back(c);
+    ASSERT_THROW(l2.remove(a), std::invalid_argument);
+    ASSERT_THROW(l2.insert_before(a, c), std::invalid_argument);
+    ASSERT_THROW(l2.insert_before(b, b), std::invalid_argument);
+    ASSERT_FALSE(l2.contains(a));
+    // Nenhuma das listas foi corrompida.
+    ASSERT_EQ(2u, l1.size());
+    ASSERT_EQ(1u, l2.size());
+    ASSERT_EQ(&a, &l1.front());
+    ASSERT_EQ(&b, &l1.back());
+    ASSERT_EQ(&c, &l2.front());
+    l1.remove(a);
+    l2.push_back(a);
+    ASSERT_TRUE(l2.contains(a));
+    ASSERT_EQ(&a, &l2.back());
+}
+
+TEST(IntrusiveListTest, OneObjectInTwoListsByTag) {
+    Item a{0}, b{1};
+    List list;
+    AgeList by_age;
+    list.push_back(a);
+    list.push_back(b);
+    by_age.push_back(b);
+    by_age.push_back(a);
+    ASSERT_EQ(&a, &list.front());
+    ASSERT_EQ(&b, &by_age.front());
+    list.remove(a);
+    ASSERT_EQ(1u, list.size());
+    ASSERT_TRUE(by_age.contains(a));
+    ASSERT_EQ(2u, by_age.size());
+}
+
+TEST(IntrusiveListTest, DestructorUnlinks) {
+    Item a{0};
+    {
+        List list;
+        list.push_back(a);
+    }
+    ASSERT_FALSE(a.structures::IntrusiveListHook<>::linked());
+    List other;
+    other.push_back(a);
+    ASSERT_EQ(1u, other.size());
+}
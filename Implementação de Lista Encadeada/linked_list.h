@@ -2,19 +2,102 @@
 #ifndef STRUCTURES_LINKED_LIST_H
 #define STRUCTURES_LINKED_LIST_H
 
+#include <cstddef>  // std::ptrdiff_t
 #include <cstdint>
-
+#include <iterator>  // std::forward_iterator_tag
+#include <memory>  // std::allocator, std::allocator_traits
+#include <type_traits>  // std::conditional, std::true_type, std::false_type
+#include <utility>  // std::swap, std::move, std::forward
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
 
 namespace structures {
 
 /// Lista Encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class LinkedList {
+    class Node;
+
  public:
+    using allocator_type = Allocator;
+
+    /// Iterador de avanço; V é T ou const T
+    template<typename V>
+    class Iterator {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::remove_const<V>::type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = V*;
+        using reference = V&;
+
+        Iterator() {}
+        /// iterator converte para const_iterator
+        template<typename W, typename = typename std::enable_if<
+            std::is_convertible<W*, V*>::value>::type>
+        Iterator(const Iterator<W>& other):
+            node_{other.node_}
+        {}
+
+        reference operator*() const {
+            return node_->data();
+        }
+        pointer operator->() const {
+            return &node_->data();
+        }
+        Iterator& operator++() {
+            node_ = node_->next();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator old = *this;
+            node_ = node_->next();
+            return old;
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.node_ == b.node_;
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.node_ != b.node_;
+        }
+
+     private:
+        friend class LinkedList;
+        template<typename>
+        friend class Iterator;
+        using NodePointer = typename std::conditional<
+            std::is_const<V>::value, const Node*, Node*>::type;
+
+        explicit Iterator(NodePointer node):
+            node_{node}
+        {}
+
+        NodePointer node_{nullptr};
+    };
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
     /// Construtor padrão
     LinkedList();
+    /// Construtor com alocador
+    explicit LinkedList(const Allocator& allocator);
+    /// Construtor de cópia: copia os nodos em O(n)
+    LinkedList(const LinkedList& other);
+    /// Construtor de cópia alocando com allocator
+    LinkedList(const LinkedList& other, const Allocator& allocator);
+    /// Construtor de movimento: toma os nodos e o alocador de other em O(1)
+    LinkedList(LinkedList&& other) noexcept;
     /// Destrutor
     ~LinkedList();
+    /// Atribuição por cópia; o alocador de cada lista não muda
+    LinkedList& operator=(const LinkedList& other);
+    /// Atribuição por movimento: O(1) se os nodos puderem trocar de dono
+    LinkedList& operator=(LinkedList&& other);
+    /// Troca o conteúdo com other em O(1)
+    void swap(LinkedList& other) noexcept;
+    /// Alocador dos nodos
+    Allocator get_allocator() const;
     /// Limpar lista
     void clear();
     /// Inserir no fim
@@ -43,6 +126,12 @@ class LinkedList {
     std::size_t find(const T& data) const;
     /// Tamanho da lista
     std::size_t size() const;
+    /// Primeiro elemento
+    iterator begin();
+    /// Depois do último elemento
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
 
  private:
     /// Elemento
@@ -82,48 +171,132 @@ class LinkedList {
         Node* next_{nullptr};
     };
     /// Último nodo da lista
-    Node* end() {
+    Node* last() {
         auto it = head;
         for (auto i = 1u; i < size(); ++i) {
             it = it->next();
         }
         return it;
     }
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Aloca e constrói um nodo
+    template<typename... Args>
+    Node* create_node(Args&&... args);
+    /// Destrói e libera um nodo
+    void destroy_node(Node* node);
+    /// Copia os dados de other, na mesma ordem, para a lista vazia
+    void append(const LinkedList& other);
+    /// Troca os nodos com other, sem mexer nos alocadores
+    void steal(LinkedList& other) noexcept;
+    /// Movimento quando o alocador acompanha os nodos
+    void move_assign(LinkedList& other, std::true_type);
+    /// Movimento quando o alocador fica: só toma os nodos se for igual
+    void move_assign(LinkedList& other, std::false_type);
+    /// Troca os alocadores, se eles acompanham a troca
+    void swap_allocator(LinkedList& other, std::true_type) noexcept;
+    void swap_allocator(LinkedList& other, std::false_type) noexcept;
 
+    NodeAllocator allocator_;
     Node* head{nullptr};
     std::size_t size_{0u};
 };
 
-}  // namespace structures
-
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Lista que aloca os nodos de um std::pmr::memory_resource
+template<typename T>
+using LinkedList =
+    structures::LinkedList<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 #endif
 
-template<typename T>
-structures::LinkedList<T>::LinkedList() {
+}  // namespace structures
+
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::LinkedList() {
     head = nullptr;
     size_ = 0;
 }
 
-template<typename T>
-structures::LinkedList<T>::~LinkedList() {
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::LinkedList(const Allocator& allocator):
+    allocator_{allocator}
+{}
+
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::LinkedList(const LinkedList& other):
+    LinkedList(other, NodeTraits::select_on_container_copy_construction(
+        other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::LinkedList(const LinkedList& other,
+                                                 const Allocator& allocator):
+    LinkedList(allocator) {
+    append(other);
+}
+
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::LinkedList(LinkedList&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>::~LinkedList() {
     clear();
 }
 
-template<typename T>
-void structures::LinkedList<T>::clear() {
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>&
+structures::LinkedList<T, Allocator>::operator=(const LinkedList& other) {
+    if (this != &other) {
+        LinkedList copy(other, get_allocator());
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::LinkedList<T, Allocator>&
+structures::LinkedList<T, Allocator>::operator=(LinkedList&& other) {
+    if (this != &other) {
+        move_assign(other, typename NodeTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::swap(LinkedList& other) noexcept {
+    steal(other);
+    swap_allocator(other,
+                   typename NodeTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::LinkedList<T, Allocator>::get_allocator() const {
+    return Allocator(allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::clear() {
     while (size_ > 0) {
         pop_front();
     }
 }
 
-template<typename T>
-void structures::LinkedList<T>::push_back(const T& data) {
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_back(const T& data) {
     insert(data, size_);
 }
 
-template<typename T>
-void structures::LinkedList<T>::push_front(const T& data) {
-    Node *new_value = new Node(data, head);
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::push_front(const T& data) {
+    Node *new_value = create_node(data, head);
     if (new_value == nullptr) {
         throw std::out_of_range("lista cheia");
     } else {
@@ -132,14 +305,15 @@ void structures::LinkedList<T>::push_front(const T& data) {
     }
 }
 
-template<typename T>
-void structures::LinkedList<T>::insert(const T& data, std::size_t index) {
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert(const T& data,
+                                                  std::size_t index) {
     if (index > size_) {
         throw std::out_of_range("posicao invalida");
     } else if (index == 0) {
         push_front(data);
     } else {
-        Node *new_value = new Node(data);
+        Node *new_value = create_node(data);
         if (new_value == nullptr) {
             throw std::out_of_range("lista cheia");
         }else {
@@ -154,8 +328,8 @@ void structures::LinkedList<T>::insert(const T& data, std::size_t index) {
     }
 }
 
-template<typename T>
-void structures::LinkedList<T>::insert_sorted(const T& data) {
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::insert_sorted(const T& data) {
     if (empty()) {
         push_front(data);
     } else {
@@ -173,8 +347,8 @@ void structures::LinkedList<T>::insert_sorted(const T& data) {
     }
 }
 
-template<typename T>
-T& structures::LinkedList<T>::at(std::size_t index) {
+template<typename T, typename Allocator>
+T& structures::LinkedList<T, Allocator>::at(std::size_t index) {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else if (index > size_ || index < 0) {
@@ -188,8 +362,8 @@ T& structures::LinkedList<T>::at(std::size_t index) {
     }
 }
 
-template<typename T>
-T structures::LinkedList<T>::pop(std::size_t index) {
+template<typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop(std::size_t index) {
     if (index >= size_) {
         throw std::out_of_range("posicao invalida");
     } else if (index == 0) {
@@ -203,18 +377,18 @@ T structures::LinkedList<T>::pop(std::size_t index) {
         T info_back = eliminate->data();
         previous->next(eliminate->next());
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-T structures::LinkedList<T>::pop_back() {
+template<typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop_back() {
     return pop(size_ - 1);
 }
 
-template<typename T>
-T structures::LinkedList<T>::pop_front() {
+template<typename T, typename Allocator>
+T structures::LinkedList<T, Allocator>::pop_front() {
     if (empty()) {
         throw std::out_of_range("lista vazia");
     } else {
@@ -222,28 +396,28 @@ T structures::LinkedList<T>::pop_front() {
         T info_back = eliminate->data();
         head = eliminate->next();
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-void structures::LinkedList<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::remove(const T& data) {
     pop(find(data));
 }
 
-template<typename T>
-bool structures::LinkedList<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::LinkedList<T, Allocator>::empty() const {
     return (size_ == 0);
 }
 
-template<typename T>
-bool structures::LinkedList<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::LinkedList<T, Allocator>::contains(const T& data) const {
     return (find(data) != size_);
 }
 
-template<typename T>
-std::size_t structures::LinkedList<T>::find(const T& data) const {
+template<typename T, typename Allocator>
+std::size_t structures::LinkedList<T, Allocator>::find(const T& data) const {
     Node* current = head;
     for (std::size_t i = 0; i < size_; i++) {
         if (data == current->data()) {
@@ -254,7 +428,106 @@ std::size_t structures::LinkedList<T>::find(const T& data) const {
     return size_;
 }
 
-template<typename T>
-std::size_t structures::LinkedList<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::LinkedList<T, Allocator>::size() const {
     return size_;
 }
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::iterator
+structures::LinkedList<T, Allocator>::begin() {
+    return iterator(head);
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::iterator
+structures::LinkedList<T, Allocator>::end() {
+    return iterator(nullptr);
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::const_iterator
+structures::LinkedList<T, Allocator>::begin() const {
+    return const_iterator(head);
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedList<T, Allocator>::const_iterator
+structures::LinkedList<T, Allocator>::end() const {
+    return const_iterator(nullptr);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+typename structures::LinkedList<T, Allocator>::Node*
+structures::LinkedList<T, Allocator>::create_node(Args&&... args) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, std::forward<Args>(args)...);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::append(const LinkedList& other) {
+    // Encadeia pelo fim guardando o último nodo.
+    Node* last = nullptr;
+    for (const T& data : other) {
+        Node* node = create_node(data);
+        if (last == nullptr) {
+            head = node;
+        } else {
+            last->next(node);
+        }
+        last = node;
+        size_++;
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::steal(LinkedList& other) noexcept {
+    std::swap(head, other.head);
+    std::swap(size_, other.size_);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::move_assign(LinkedList& other,
+                                                       std::true_type) {
+    clear();
+    allocator_ = std::move(other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::move_assign(LinkedList& other,
+                                                       std::false_type) {
+    clear();
+    if (allocator_ == other.allocator_) {
+        steal(other);
+    } else {
+        // Nodos de outro alocador não podem ser liberados por este.
+        append(other);
+        other.clear();
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::swap_allocator(
+        LinkedList& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedList<T, Allocator>::swap_allocator(
+        LinkedList&, std::false_type) noexcept {}
+
+#endif
@@ -0,0 +1,96 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_linked_list.cpp
+
+#include "gtest/gtest.h"
+#include "linked_list.h"
+#include "linked_list.h"
+#include "../tests_memory_resource.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#if __cplusplus >= 202002L
+// Os iteradores satisfazem o conceito de std::ranges esperado.
+static_assert(std::ranges::forward_range<structures::LinkedList<int>>);
+static_assert(std::ranges::forward_range<const structures::LinkedList<int>>);
+static_assert(!std::ranges::bidirectional_range<structures::LinkedList<int>>);
+#endif
+
+TEST(LinkedListIteratorTest, EmptyList) {
+    structures::LinkedList<int> list;
+    ASSERT_TRUE(list.begin() == list.end());
+    const auto& view = list;
+    ASSERT_TRUE(view.begin() == view.end());
+}
+
+TEST(LinkedListIteratorTest, RangeForVisitsInOrder) {
+    structures::LinkedList<int> list;
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    auto expected = 0;
+    for (auto value : list) {
+        ASSERT_EQ(expected++, value);
+    }
+    ASSERT_EQ(10, expected);
+    for (auto& value : list) {
+        value *= 2;
+    }
+    ASSERT_EQ(18, list.at(9));
+}
+
+TEST(LinkedListIteratorTest, StandardAlgorithms) {
+    structures::LinkedList<std::string> list;
+    for (auto word : {"um", "dois", "tres"}) {
+        list.push_back(word);
+    }
+    ASSERT_EQ(3, std::distance(list.begin(), list.end()));
+    auto it = std::find(list.begin(), list.end(), "dois");
+    ASSERT_EQ("dois", *it);
+    ASSERT_EQ(4u, it->size());
+    ASSERT_TRUE(std::find(list.begin(), list.end(), "x") == list.end());
+
+    const auto& view = list;
+    structures::LinkedList<std::string>::const_iterator first = list.begin();
+    ASSERT_TRUE(first == view.begin());
+    std::vector<std::string> copy(view.begin(), view.end());
+    ASSERT_EQ((std::vector<std::string>{"um", "dois", "tres"}), copy);
+
+    structures::LinkedList<int> numbers;
+    for (auto i = 1; i <= 100; ++i) {
+        numbers.push_back(i);
+    }
+    ASSERT_EQ(5050, std::accumulate(numbers.begin(), numbers.end(), 0));
+    ASSERT_EQ(50, std::count_if(numbers.begin(), numbers.end(),
+                                [](int x) { return x % 2 == 0; }));
+}
+
+#if __cplusplus >= 201703L
+TEST(LinkedListAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::LinkedList<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.push_back(std::move(value));
+        },
+        [](C& list, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_EQ(tests::long_value(i), list.at(i));
+            }
+        });
+}
+#endif
@@ -0,0 +1,64 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_array_list_shift.cpp
+///
+/// Inserir e remover no início e no meio de uma ArrayList com 1K a 10M
+/// elementos. ArrayList<int> desloca com memmove; Boxed tem o mesmo tamanho
+/// mas cópia definida pelo usuário, então desloca elemento a elemento.
+///
+///     g++ -std=c++14 -O2 bench_array_list_shift.cpp -o bench
+#include "array_list.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+
+namespace {
+
+/// int com cópia e atribuição não triviais
+struct Boxed {
+    Boxed() {}
+    Boxed(int value_): value{value_} {}  // NOLINT
+    Boxed(const Boxed& other): value{other.value} {}
+    Boxed& operator=(const Boxed& other) {
+        value = other.value;
+        return *this;
+    }
+    int value{0};
+};
+
+/// Nanossegundos por par insere/remove na posição index(n) de uma lista
+/// com n elementos; shifted limita o total de elementos deslocados
+template<typename T, typename Index>
+double shift(std::size_t n, std::size_t shifted, Index index) {
+    structures::ArrayList<T> list(n + 1);
+    for (std::size_t i = 0; i < n; i++) {
+        list.push_back(T(static_cast<int>(i)));
+    }
+    std::size_t pairs = shifted / n > 0 ? shifted / n : 1;
+    double seconds = bench::seconds([&] {
+        for (std::size_t i = 0; i < pairs; i++) {
+            list.insert(T(static_cast<int>(i)), index(n));
+            bench::keep(list.pop(index(n)));
+        }
+    }, 1);
+    return seconds * 1e9 / pairs;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t shifted = bench::scaled(400000000, bench::scale(argc, argv));
+    auto front = [](std::size_t) { return std::size_t(0); };
+    auto middle = [](std::size_t n) { return n / 2; };
+
+    std::printf("%10s %14s %14s %14s %14s\n", "n", "front int",
+                "front Boxed", "middle int", "middle Boxed");
+    for (std::size_t n = 1000; n <= 10000000; n *= 10) {
+        std::printf("%10zu %14.0f %14.0f %14.0f %14.0f\n", n,
+                    shift<int>(n, shifted, front),
+                    shift<Boxed>(n, shifted, front),
+                    shift<int>(n, shifted, middle),
+                    shift<Boxed>(n, shifted, middle));
+    }
+    std::printf("(ns por par insere/remove)\n");
+    return 0;
+}
@@ -0,0 +1,139 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_dijkstra.cpp
+///
+/// Dijkstra em grafos aleatórios com grau médio 4 e 16: PairingHeap com
+/// decrease_key contra PriorityQueue 4-ária com entradas repetidas
+/// (as obsoletas são descartadas ao sair).
+///
+///     g++ -std=c++14 -O2 bench_dijkstra.cpp -o bench
+#include "pairing_heap.h"
+#include "priority_queue.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Entry = std::pair<long, int>;  // distância, vértice
+
+const long INFINITE = std::numeric_limits<long>::max();
+
+/// Grafo dirigido em listas de adjacência compactas
+struct Graph {
+    std::vector<std::size_t> first;  // arestas de v: [first[v], first[v+1])
+    std::vector<int> target;
+    std::vector<long> weight;
+};
+
+/// n vértices, um ciclo para tudo ser alcançável e degree - 1 arestas
+/// aleatórias por vértice, pesos de 1 a 1000
+Graph random_graph(int n, int degree) {
+    Graph graph;
+    graph.first.push_back(0);
+    for (int v = 0; v < n; v++) {
+        graph.target.push_back((v + 1) % n);
+        graph.weight.push_back(1 + std::rand() % 1000);
+        for (int e = 1; e < degree; e++) {
+            graph.target.push_back(std::rand() % n);
+            graph.weight.push_back(1 + std::rand() % 1000);
+        }
+        graph.first.push_back(graph.target.size());
+    }
+    return graph;
+}
+
+/// Soma das distâncias a partir de 0, com decrease_key
+long pairing(const Graph& graph) {
+    std::size_t n = graph.first.size() - 1;
+    using Heap = structures::PairingHeap<Entry>;
+    std::vector<long> distance(n, INFINITE);
+    std::vector<Heap::Handle> handle(n);
+    std::vector<char> queued(n, 0);
+    Heap heap;
+    distance[0] = 0;
+    handle[0] = heap.push(Entry(0, 0));
+    queued[0] = 1;
+    long sum = 0;
+    while (!heap.empty()) {
+        Entry entry = heap.pop();
+        int v = entry.second;
+        queued[v] = 0;
+        sum += entry.first;
+        for (auto e = graph.first[v]; e < graph.first[v + 1]; e++) {
+            int w = graph.target[e];
+            long through = entry.first + graph.weight[e];
+            if (through < distance[w]) {
+                distance[w] = through;
+                if (queued[w]) {
+                    heap.decrease_key(handle[w], Entry(through, w));
+                } else {
+                    handle[w] = heap.push(Entry(through, w));
+                    queued[w] = 1;
+                }
+            }
+        }
+    }
+    return sum;
+}
+
+/// Idem inserindo de novo em vez de diminuir a chave
+long lazy(const Graph& graph) {
+    std::size_t n = graph.first.size() - 1;
+    std::vector<long> distance(n, INFINITE);
+    structures::PriorityQueue<Entry, std::less<Entry>, 4> queue(
+        graph.target.size() + 1);
+    distance[0] = 0;
+    queue.push(Entry(0, 0));
+    long sum = 0;
+    while (!queue.empty()) {
+        Entry entry = queue.pop();
+        int v = entry.second;
+        if (entry.first > distance[v]) {
+            continue;
+        }
+        sum += entry.first;
+        for (auto e = graph.first[v]; e < graph.first[v + 1]; e++) {
+            int w = graph.target[e];
+            long through = entry.first + graph.weight[e];
+            if (through < distance[w]) {
+                distance[w] = through;
+                queue.push(Entry(through, w));
+            }
+        }
+    }
+    return sum;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    double factor = bench::scale(argc, argv);
+
+    std::printf("%10s %7s %14s %14s\n", "vertices", "degree", "pairing ms",
+                "lazy 4-ary ms");
+    std::srand(13);
+    for (int n = 10000; n <= 1000000; n *= 10) {
+        int vertices = static_cast<int>(bench::scaled(n, factor));
+        for (int degree : {4, 16}) {
+            Graph graph = random_graph(vertices, degree);
+            long expected = lazy(graph);
+            if (pairing(graph) != expected) {
+                std::fprintf(stderr, "distancias diferentes\n");
+                return 1;
+            }
+            double heap = bench::seconds([&] {
+                bench::keep(pairing(graph));
+            });
+            double queue = bench::seconds([&] {
+                bench::keep(lazy(graph));
+            });
+            std::printf("%10d %7d %14.2f %14.2f\n", vertices, degree,
+                        heap * 1e3, queue * 1e3);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,93 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_parallel_algorithms.cpp
+///
+/// Escalabilidade dos algoritmos de parallel:: sobre uma ArrayList<long>
+/// com 10M elementos, de 1 a N threads (N = threads de hardware). A linha
+/// "std" mostra os algoritmos seriais da biblioteca padrão no mesmo vetor.
+///
+///     g++ -std=c++14 -O2 -pthread bench_parallel_algorithms.cpp -o bench
+#include "parallel_algorithms.h"
+#include "../benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+
+namespace {
+
+/// Milissegundos de stable_sort(list), partindo sempre da mesma lista
+template<typename Sort>
+double sort_ms(const structures::ArrayList<long>& unsorted, Sort sort) {
+    double best = 0;
+    for (int i = 0; i < 3; i++) {
+        structures::ArrayList<long> list(unsorted);
+        bench::Clock::time_point start = bench::Clock::now();
+        sort(list);
+        double elapsed = bench::since(start);
+        if (i == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best * 1e3;
+}
+
+/// Milissegundos de f()
+template<typename F>
+double ms(F f) {
+    return bench::seconds([&] { bench::keep(f()); }) * 1e3;
+}
+
+void header() {
+    std::printf("%8s %10s %10s %10s %10s %10s\n", "threads", "sort ms",
+                "find ms", "count ms", "transf ms", "reduce ms");
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t n = bench::scaled(10000000, bench::scale(argc, argv));
+    structures::ArrayList<long> list(n);
+    for (std::size_t i = 0; i < n; i++) {
+        list.push_back(static_cast<long>((i * 7919) % 1000003));
+    }
+    auto absent = [](long x) { return x < 0; };
+    auto odd = [](long x) { return x % 2 != 0; };
+    auto step = [](long x) { return x ^ 0x5555; };
+    auto add = [](long a, long b) { return a + b; };
+
+    header();
+    std::printf("%8s %10.1f %10.1f %10.1f %10.1f %10.1f\n", "std",
+        sort_ms(list, [](structures::ArrayList<long>& l) {
+            std::stable_sort(l.begin(), l.end());
+        }),
+        ms([&] { return std::find_if(list.begin(), list.end(), absent); }),
+        ms([&] { return std::count_if(list.begin(), list.end(), odd); }),
+        ms([&] {
+            std::transform(list.begin(), list.end(), list.begin(), step);
+            return list.at(0);
+        }),
+        ms([&] { return std::accumulate(list.begin(), list.end(), 0L); }));
+
+    for (auto threads : bench::thread_counts(bench::hardware_threads())) {
+        // A thread que chama também trabalha.
+        structures::ThreadPool pool(threads - 1);
+        std::printf("%8u %10.1f %10.1f %10.1f %10.1f %10.1f\n", threads,
+            sort_ms(list, [&](structures::ArrayList<long>& l) {
+                structures::parallel::stable_sort(l, std::less<long>(), pool);
+            }),
+            ms([&] {
+                return structures::parallel::find_first(list, absent, pool);
+            }),
+            ms([&] {
+                return structures::parallel::count_if(list, odd, pool);
+            }),
+            ms([&] {
+                structures::parallel::transform(list, step, pool);
+                return list.at(0);
+            }),
+            ms([&] {
+                return structures::parallel::reduce(list, 0, add, pool);
+            }));
+    }
+    return 0;
+}
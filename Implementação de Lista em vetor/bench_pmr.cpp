@@ -0,0 +1,95 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_pmr.cpp
+///
+/// "Requisições" que montam um contêiner com n ints e o descartam, com o
+/// recurso padrão (new/delete), com um std::pmr::monotonic_buffer_resource
+/// liberado ao fim de cada requisição e com um
+/// std::pmr::unsynchronized_pool_resource. ArrayList, LinkedList e
+/// AVLTree pelos aliases structures::pmr::*.
+///
+///     g++ -std=c++17 -O2 bench_pmr.cpp -o bench
+#if __cplusplus < 201703L
+#error "bench_pmr.cpp precisa de C++17 (std::pmr)"
+#endif
+
+#include "array_list.h"
+#include "../Implementação de Lista Encadeada/linked_list.h"
+#include "../Árvore AVL/avl_tree.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+#include <memory_resource>
+#include <vector>
+
+namespace {
+
+/// Insere n valores embaralhados
+template<typename Container, typename Insert>
+void fill(Container& container, int n, Insert insert) {
+    for (int i = 0; i < n; i++) {
+        insert(container, (i * 7919) % n);
+    }
+}
+
+/// Microssegundos por requisição com cada recurso
+template<typename Container, typename Insert>
+void requests(const char* name, int n, std::size_t count, Insert insert) {
+    double plain = bench::seconds([&] {
+        for (std::size_t r = 0; r < count; r++) {
+            Container container(std::pmr::new_delete_resource());
+            fill(container, n, insert);
+            bench::keep(container.size());
+        }
+    });
+    // Arena reaproveitada entre requisições: release() devolve tudo de
+    // uma vez, e o buffer inicial evita ir ao sistema.
+    std::vector<char> buffer(1 << 20);
+    double monotonic = bench::seconds([&] {
+        std::pmr::monotonic_buffer_resource arena(buffer.data(),
+                                                  buffer.size());
+        for (std::size_t r = 0; r < count; r++) {
+            {
+                Container container(&arena);
+                fill(container, n, insert);
+                bench::keep(container.size());
+            }
+            arena.release();
+        }
+    });
+    double pool = bench::seconds([&] {
+        std::pmr::unsynchronized_pool_resource resource;
+        for (std::size_t r = 0; r < count; r++) {
+            Container container(&resource);
+            fill(container, n, insert);
+            bench::keep(container.size());
+        }
+    });
+    double scale = 1e6 / count;
+    std::printf("%-12s %6d %12.2f %12.2f %12.2f\n", name, n, plain * scale,
+                monotonic * scale, pool * scale);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    double factor = bench::scale(argc, argv);
+
+    std::printf("%-12s %6s %12s %12s %12s\n", "", "n", "default us",
+                "monotonic us", "pool us");
+    for (int n : {100, 10000}) {
+        std::size_t count = bench::scaled(2000000 / n, factor);
+        requests<structures::pmr::ArrayList<int>>("ArrayList", n, count,
+            [](structures::pmr::ArrayList<int>& list, int value) {
+                list.push_back(value);
+            });
+        requests<structures::pmr::LinkedList<int>>("LinkedList", n, count,
+            [](structures::pmr::LinkedList<int>& list, int value) {
+                list.push_front(value);
+            });
+        requests<structures::pmr::AVLTree<int>>("AVLTree", n, count,
+            [](structures::pmr::AVLTree<int>& tree, int value) {
+                tree.insert(value);
+            });
+    }
+    return 0;
+}
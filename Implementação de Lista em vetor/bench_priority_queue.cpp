@@ -0,0 +1,93 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_priority_queue.cpp
+///
+/// Inserir n ints aleatórios e retirar todos em ordem: PriorityQueue
+/// binária e 4-ária, construção em O(n) a partir do vetor, e a emulação
+/// com ArrayList::insert_sorted + pop_front (O(n) por operação, medida só
+/// até 100K).
+///
+///     g++ -std=c++14 -O2 bench_priority_queue.cpp -o bench
+#include "array_list.h"
+#include "priority_queue.h"
+#include "../benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+/// Nanossegundos por elemento de push de todos e pop de todos
+template<typename Queue>
+double push_pop(const std::vector<int>& data) {
+    double seconds = bench::seconds([&] {
+        Queue queue(data.size());
+        for (auto value : data) {
+            queue.push(value);
+        }
+        long sum = 0;
+        while (!queue.empty()) {
+            sum += queue.pop();
+        }
+        bench::keep(sum);
+    });
+    return seconds * 1e9 / data.size();
+}
+
+/// Idem construindo o heap de uma vez
+double heapify_pop(const std::vector<int>& data) {
+    double seconds = bench::seconds([&] {
+        structures::PriorityQueue<int, std::less<int>, 4> queue(
+            data.data(), data.size(), data.size());
+        long sum = 0;
+        while (!queue.empty()) {
+            sum += queue.pop();
+        }
+        bench::keep(sum);
+    });
+    return seconds * 1e9 / data.size();
+}
+
+/// Idem com a lista ordenada
+double sorted_list(const std::vector<int>& data) {
+    double seconds = bench::seconds([&] {
+        structures::ArrayList<int> list(data.size());
+        for (auto value : data) {
+            list.insert_sorted(value);
+        }
+        long sum = 0;
+        while (!list.empty()) {
+            sum += list.pop_front();
+        }
+        bench::keep(sum);
+    }, 1);
+    return seconds * 1e9 / data.size();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    double factor = bench::scale(argc, argv);
+
+    std::printf("%10s %12s %12s %12s %14s\n", "n", "binary ns", "4-ary ns",
+                "heapify ns", "insert_sorted");
+    std::srand(12);
+    for (std::size_t n = 1000; n <= 1000000; n *= 10) {
+        std::vector<int> data(bench::scaled(n, factor));
+        for (auto& value : data) {
+            value = std::rand();
+        }
+        double binary = push_pop<structures::PriorityQueue<int>>(data);
+        double quaternary =
+            push_pop<structures::PriorityQueue<int, std::less<int>, 4>>(data);
+        double heapify = heapify_pop(data);
+        std::printf("%10zu %12.1f %12.1f %12.1f ", data.size(), binary,
+                    quaternary, heapify);
+        if (n <= 100000) {
+            std::printf("%14.1f\n", sorted_list(data));
+        } else {
+            std::printf("%14s\n", "-");
+        }
+    }
+    return 0;
+}
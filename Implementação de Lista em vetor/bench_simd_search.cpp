@@ -0,0 +1,80 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_simd_search.cpp
+///
+/// simd::find, count, min e max contra std::find, std::count,
+/// std::min_element e std::max_element, para int e double com 1K, 1M e
+/// 100M elementos. find procura um valor ausente (varre tudo).
+///
+///     g++ -std=c++14 -O2 bench_simd_search.cpp -o bench
+#include "simd_search.h"
+#include "../benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+/// Gigaelementos por segundo de f() sobre n elementos
+template<typename F>
+double rate(std::size_t n, std::size_t budget, F f) {
+    std::size_t repeat = budget / n > 0 ? budget / n : 1;
+    double seconds = bench::seconds([&] {
+        for (std::size_t r = 0; r < repeat; r++) {
+            bench::keep(f());
+        }
+    });
+    return repeat * n / seconds / 1e9;
+}
+
+/// Imprime uma linha por operação para T com n elementos
+template<typename T>
+void compare(const char* type, std::size_t n, std::size_t budget) {
+    std::vector<T> data(n);
+    for (std::size_t i = 0; i < n; i++) {
+        data[i] = static_cast<T>((i * 7919) % 100003);
+    }
+    const T* p = data.data();
+    const T absent = static_cast<T>(-1);
+    const T present = data[n / 2];
+    auto row = [&](const char* op, double simd, double plain) {
+        std::printf("%7s %10zu %6s %12.2f %12.2f %8.2fx\n", type, n, op,
+                    simd, plain, simd / plain);
+    };
+    row("find", rate(n, budget, [&] {
+        return structures::simd::find(p, n, absent);
+    }), rate(n, budget, [&] {
+        return std::find(p, p + n, absent) - p;
+    }));
+    row("count", rate(n, budget, [&] {
+        return structures::simd::count(p, n, present);
+    }), rate(n, budget, [&] {
+        return std::count(p, p + n, present);
+    }));
+    row("min", rate(n, budget, [&] {
+        return structures::simd::min(p, n);
+    }), rate(n, budget, [&] {
+        return *std::min_element(p, p + n);
+    }));
+    row("max", rate(n, budget, [&] {
+        return structures::simd::max(p, n);
+    }), rate(n, budget, [&] {
+        return *std::max_element(p, p + n);
+    }));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    double factor = bench::scale(argc, argv);
+    std::size_t budget = bench::scaled(1000000000, factor);
+
+    std::printf("%7s %10s %6s %12s %12s %9s\n", "type", "n", "op",
+                "simd Gel/s", "std Gel/s", "speedup");
+    for (std::size_t n : {1000u, 1000000u, 100000000u}) {
+        std::size_t size = bench::scaled(n, factor < 1 ? factor : 1);
+        compare<int>("int", size, budget);
+        compare<double>("double", size, budget);
+    }
+    return 0;
+}
@@ -0,0 +1,463 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_PAIRING_HEAP_H
+#define STRUCTURES_PAIRING_HEAP_H
+
+#include <cstdint>
+#include <functional>  // std::less
+#include <memory>  // std::allocator
+#include <new>  // placement new
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_nothrow_move_constructible
+#include <utility>  // std::move, std::swap
+#include <vector>
+
+namespace structures {
+
+/// Heap de emparelhamento endereçável. O topo é o menor elemento segundo
+/// Compare; push devolve um Handle estável que permite decrease_key e erase.
+template<typename T, typename Compare = std::less<T>>
+class PairingHeap {
+    struct Node;
+
+ public:
+    /// Referência estável a um elemento inserido.
+    class Handle {
+     public:
+        Handle() {}
+
+     private:
+        friend class PairingHeap;
+        explicit Handle(Node* node): node_{node} {}
+        Node* node_{nullptr};
+    };
+
+    /// Construtor.
+    PairingHeap();
+    /// Construtor com comparador.
+    explicit PairingHeap(const Compare& compare);
+    /// Destrutor.
+    ~PairingHeap();
+    /// Cópia não suportada.
+    PairingHeap(const PairingHeap&) = delete;
+    /// Atribuição não suportada.
+    PairingHeap& operator=(const PairingHeap&) = delete;
+    /// Construtor por movimento: toma os nodos em O(1); os handles
+    /// continuam válidos e other fica vazio.
+    PairingHeap(PairingHeap&& other)
+        noexcept(std::is_nothrow_move_constructible<Compare>::value);
+    /// Atribuição por movimento: destrói os elementos atuais e toma os de
+    /// other (os blocos de ambos ficam aqui para reuso).
+    PairingHeap& operator=(PairingHeap&& other)
+        noexcept(std::is_nothrow_move_assignable<Compare>::value);
+
+    /// Limpa o heap, invalidando os handles.
+    void clear();
+    /// Insere em O(1).
+    Handle push(const T& data);
+    /// Insere movendo o dado em O(1).
+    Handle push(T&& data);
+    /// Retira o topo em O(log n) amortizado.
+    T pop();
+    /// Elemento do topo.
+    const T& top() const;
+    /// Dado referenciado pelo handle.
+    const T& value(Handle handle) const;
+    /// Troca o dado por um de maior prioridade em O(1) amortizado.
+    void decrease_key(Handle handle, const T& data);
+    /// Remove o elemento referenciado em O(log n) amortizado.
+    void erase(Handle handle);
+    /// Absorve todos os elementos de other em O(1); os handles continuam
+    /// válidos e passam a se referir a este heap.
+    void meld(PairingHeap& other);
+    /// Vazio.
+    bool empty() const;
+    /// Tamanho.
+    std::size_t size() const;
+
+ private:
+    /// Nodo: prev é o pai se for o filho mais à esquerda, senão o irmão
+    /// à esquerda.
+    struct Node {
+        template<typename U>
+        explicit Node(U&& data_):
+            data{std::forward<U>(data_)}
+        {}
+
+        T data;
+        Node* child{nullptr};
+        Node* sibling{nullptr};
+        Node* prev{nullptr};
+    };
+
+    /// Reserva de nodos em blocos, com lista de livres
+    class NodePool {
+     public:
+        ~NodePool();
+        Node* allocate();
+        void release(Node* node);
+        /// Toma para si os blocos e livres de other em O(1).
+        void absorb(NodePool& other) noexcept;
+
+     private:
+        /// Posição livre: reaproveita a memória do nodo
+        struct FreeSlot {
+            FreeSlot* next;
+        };
+        /// Cabeçalho guardado no primeiro nodo de cada bloco, que encadeia
+        /// os blocos sem alocação à parte (e permite emendá-los em O(1))
+        struct Chunk {
+            Chunk* next;
+            std::size_t size;
+        };
+        static_assert(sizeof(Chunk) <= sizeof(Node) &&
+                      alignof(Chunk) <= alignof(Node),
+                      "o cabeçalho precisa caber num nodo");
+
+        static const std::size_t FIRST_CHUNK = 16;
+        static const std::size_t MAX_CHUNK = 1024;
+
+        Chunk* chunks{nullptr};
+        Chunk* last_chunk{nullptr};
+        FreeSlot* free_list{nullptr};
+        FreeSlot* free_tail{nullptr};
+        std::size_t next_chunk{FIRST_CHUNK};
+    };
+
+    template<typename U>
+    Handle emplace(U&& data);
+    /// Une duas árvores; a de menor raiz fica no topo.
+    Node* link(Node* a, Node* b);
+    /// Desliga o nodo (e sua subárvore) do pai.
+    void cut(Node* node);
+    /// Une a lista de irmãos em duas passadas.
+    Node* merge_pairs(Node* first);
+    /// Destrói o dado e devolve o nodo à reserva.
+    void destroy(Node* node);
+
+    NodePool pool;
+    Node* root{nullptr};
+    std::size_t size_{0u};
+    Compare compare;
+};
+
+}  // namespace structures
+
+template<typename T, typename Compare>
+structures::PairingHeap<T, Compare>::PairingHeap() {}
+
+template<typename T, typename Compare>
+structures::PairingHeap<T, Compare>::PairingHeap(const Compare& compare_):
+    compare(compare_)
+{}
+
+template<typename T, typename Compare>
+structures::PairingHeap<T, Compare>::PairingHeap(PairingHeap&& other)
+        noexcept(std::is_nothrow_move_constructible<Compare>::value):
+    root{other.root},
+    size_{other.size_},
+    compare(std::move(other.compare))
+{
+    pool.absorb(other.pool);
+    other.root = nullptr;
+    other.size_ = 0;
+}
+
+template<typename T, typename Compare>
+structures::PairingHeap<T, Compare>::~PairingHeap() {
+    clear();
+}
+
+template<typename T, typename Compare>
+structures::PairingHeap<T, Compare>&
+structures::PairingHeap<T, Compare>::operator=(PairingHeap&& other)
+        noexcept(std::is_nothrow_move_assignable<Compare>::value) {
+    if (this != &other) {
+        clear();
+        pool.absorb(other.pool);
+        root = other.root;
+        size_ = other.size_;
+        compare = std::move(other.compare);
+        other.root = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+template<typename T, typename Compare>
+void structures::PairingHeap<T, Compare>::clear() {
+    // Percorre a árvore usando uma pilha explícita.
+    std::vector<Node*> pending;
+    if (root != nullptr) {
+        pending.push_back(root);
+    }
+    while (!pending.empty()) {
+        Node* node = pending.back();
+        pending.pop_back();
+        if (node->child != nullptr) {
+            pending.push_back(node->child);
+        }
+        if (node->sibling != nullptr) {
+            pending.push_back(node->sibling);
+        }
+        destroy(node);
+    }
+    root = nullptr;
+    size_ = 0;
+}
+
+template<typename T, typename Compare>
+typename structures::PairingHeap<T, Compare>::Handle
+structures::PairingHeap<T, Compare>::push(const T& data) {
+    return emplace(data);
+}
+
+template<typename T, typename Compare>
+typename structures::PairingHeap<T, Compare>::Handle
+structures::PairingHeap<T, Compare>::push(T&& data) {
+    return emplace(std::move(data));
+}
+
+template<typename T, typename Compare>
+T structures::PairingHeap<T, Compare>::pop() {
+    if (empty()) {
+        throw std::out_of_range("heap vazio");
+    }
+    Node* old_root = root;
+    T data = std::move(old_root->data);
+    root = merge_pairs(old_root->child);
+    destroy(old_root);
+    size_--;
+    return data;
+}
+
+template<typename T, typename Compare>
+const T& structures::PairingHeap<T, Compare>::top() const {
+    if (empty()) {
+        throw std::out_of_range("heap vazio");
+    }
+    return root->data;
+}
+
+template<typename T, typename Compare>
+const T& structures::PairingHeap<T, Compare>::value(Handle handle) const {
+    return handle.node_->data;
+}
+
+template<typename T, typename Compare>
+void structures::PairingHeap<T, Compare>::decrease_key(Handle handle,
+                                                      const T& data) {
+    Node* node = handle.node_;
+    if (compare(node->data, data)) {
+        throw std::invalid_argument("nova chave tem menor prioridade");
+    }
+    node->data = data;
+    if (node != root) {
+        cut(node);
+        root = link(root, node);
+    }
+}
+
+template<typename T, typename Compare>
+void structures::PairingHeap<T, Compare>::erase(Handle handle) {
+    Node* node = handle.node_;
+    if (node == root) {
+        pop();
+        return;
+    }
+    cut(node);
+    Node* children = merge_pairs(node->child);
+    if (children != nullptr) {
+        root = link(root, children);
+    }
+    destroy(node);
+    size_--;
+}
+
+template<typename T, typename Compare>
+void structures::PairingHeap<T, Compare>::meld(PairingHeap& other) {
+    if (&other == this) {
+        return;
+    }
+    pool.absorb(other.pool);
+    if (other.root != nullptr) {
+        root = root != nullptr ? link(root, other.root) : other.root;
+    }
+    size_ += other.size_;
+    other.root = nullptr;
+    other.size_ = 0;
+}
+
+template<typename T, typename Compare>
+bool structures::PairingHeap<T, Compare>::empty() const {
+    return (size_ == 0);
+}
+
+template<typename T, typename Compare>
+std::size_t structures::PairingHeap<T, Compare>::size() const {
+    return size_;
+}
+
+template<typename T, typename Compare>
+template<typename U>
+typename structures::PairingHeap<T, Compare>::Handle
+structures::PairingHeap<T, Compare>::emplace(U&& data) {
+    Node* memory = pool.allocate();
+    Node* node;
+    try {
+        node = new (memory) Node(std::forward<U>(data));
+    } catch (...) {
+        pool.release(memory);
+        throw;
+    }
+    root = root != nullptr ? link(root, node) : node;
+    size_++;
+    return Handle(node);
+}
+
+template<typename T, typename Compare>
+typename structures::PairingHeap<T, Compare>::Node*
+structures::PairingHeap<T, Compare>::link(Node* a, Node* b) {
+    if (compare(b->data, a->data)) {
+        std::swap(a, b);
+    }
+    // b vira o filho mais à esquerda de a.
+    b->sibling = a->child;
+    if (a->child != nullptr) {
+        a->child->prev = b;
+    }
+    b->prev = a;
+    a->child = b;
+    a->sibling = nullptr;
+    a->prev = nullptr;
+    return a;
+}
+
+template<typename T, typename Compare>
+void structures::PairingHeap<T, Compare>::cut(Node* node) {
+    if (node->prev->child == node) {
+        node->prev->child = node->sibling;
+    } else {
+        node->prev->sibling = node->sibling;
+    }
+    if (node->sibling != nullptr) {
+        node->sibling->prev = node->prev;
+    }
+    node->prev = nullptr;
+    node->sibling = nullptr;
+}
+
+template<typename T, typename Compare>
+typename structures::PairingHeap<T, Compare>::Node*
+structures::PairingHeap<T, Compare>::merge_pairs(Node* first) {
+    if (first == nullptr) {
+        return nullptr;
+    }
+    // Primeira passada: une pares da esquerda para a direita, empilhando
+    // os resultados (encadeados por sibling, em ordem inversa).
+    Node* paired = nullptr;
+    while (first != nullptr) {
+        Node* a = first;
+        Node* b = a->sibling;
+        if (b == nullptr) {
+            a->prev = nullptr;
+            a->sibling = paired;
+            paired = a;
+            break;
+        }
+        first = b->sibling;
+        a->sibling = nullptr;
+        b->sibling = nullptr;
+        Node* ab = link(a, b);
+        ab->sibling = paired;
+        paired = ab;
+    }
+    // Segunda passada: une da direita para a esquerda.
+    Node* result = paired;
+    paired = paired->sibling;
+    result->sibling = nullptr;
+    while (paired != nullptr) {
+        Node* next = paired->sibling;
+        paired->sibling = nullptr;
+        result = link(result, paired);
+        paired = next;
+    }
+    return result;
+}
+
+template<typename T, typename Compare>
+void structures::PairingHeap<T, Compare>::destroy(Node* node) {
+    node->~Node();
+    pool.release(node);
+}
+
+template<typename T, typename Compare>
+structures::PairingHeap<T, Compare>::NodePool::~NodePool() {
+    while (chunks != nullptr) {
+        Chunk* chunk = chunks;
+        chunks = chunk->next;
+        std::allocator<Node>().deallocate(reinterpret_cast<Node*>(chunk),
+                                          chunk->size);
+    }
+}
+
+template<typename T, typename Compare>
+typename structures::PairingHeap<T, Compare>::Node*
+structures::PairingHeap<T, Compare>::NodePool::allocate() {
+    if (free_list == nullptr) {
+        // Novo bloco, cada um maior que o anterior; o nodo 0 é o
+        // cabeçalho.
+        Node* nodes = std::allocator<Node>().allocate(next_chunk);
+        Chunk* chunk = new (nodes) Chunk{chunks, next_chunk};
+        if (chunks == nullptr) {
+            last_chunk = chunk;
+        }
+        chunks = chunk;
+        for (std::size_t i = next_chunk; i > 1; i--) {
+            release(nodes + i - 1);
+        }
+        if (next_chunk < MAX_CHUNK) {
+            next_chunk *= 2;
+        }
+    }
+    FreeSlot* slot = free_list;
+    free_list = slot->next;
+    if (free_list == nullptr) {
+        free_tail = nullptr;
+    }
+    return reinterpret_cast<Node*>(slot);
+}
+
+template<typename T, typename Compare>
+void structures::PairingHeap<T, Compare>::NodePool::release(Node* node) {
+    FreeSlot* slot = new (node) FreeSlot;
+    slot->next = free_list;
+    if (free_list == nullptr) {
+        free_tail = slot;
+    }
+    free_list = slot;
+}
+
+template<typename T, typename Compare>
+void structures::PairingHeap<T, Compare>::NodePool::absorb(NodePool& other)
+        noexcept {
+    if (other.chunks != nullptr) {
+        other.last_chunk->next = chunks;
+        if (chunks == nullptr) {
+            last_chunk = other.last_chunk;
+        }
+        chunks = other.chunks;
+        other.chunks = nullptr;
+        other.last_chunk = nullptr;
+    }
+    if (other.free_list != nullptr) {
+        other.free_tail->next = free_list;
+        if (free_list == nullptr) {
+            free_tail = other.free_tail;
+        }
+        free_list = other.free_list;
+        other.free_list = nullptr;
+        other.free_tail = nullptr;
+    }
+}
+
+#endif
@@ -0,0 +1,334 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_PARALLEL_ALGORITHMS_H
+#define STRUCTURES_PARALLEL_ALGORITHMS_H
+
+#include <algorithm>  // std::stable_sort, std::merge, std::find_if
+#include <atomic>
+#include <cstdint>
+#include <functional>  // std::less
+#include <iterator>  // std::make_move_iterator
+#include <memory>  // std::allocator, std::uninitialized_copy
+#include <utility>  // std::move, std::swap
+#include <vector>
+
+#include "array_list.h"
+#include "thread_pool.h"
+
+namespace structures {
+
+/// Algoritmos sobre ArrayList divididos em blocos contíguos, um por thread
+/// de ThreadPool. Listas pequenas rodam direto na thread que chama.
+namespace parallel {
+
+/// Ordena mantendo a ordem relativa dos iguais
+template<typename T, typename Allocator, typename Compare = std::less<T>>
+void stable_sort(ArrayList<T, Allocator>& list, Compare compare = Compare(),
+                 ThreadPool& pool = ThreadPool::shared());
+
+/// Posição do primeiro elemento que satisfaz pred, ou size() se não houver
+template<typename T, typename Allocator, typename Predicate>
+std::size_t find_first(const ArrayList<T, Allocator>& list, Predicate pred,
+                       ThreadPool& pool = ThreadPool::shared());
+
+/// Quantidade de elementos que satisfazem pred
+template<typename T, typename Allocator, typename Predicate>
+std::size_t count_if(const ArrayList<T, Allocator>& list, Predicate pred,
+                     ThreadPool& pool = ThreadPool::shared());
+
+/// Substitui cada elemento x por function(x)
+template<typename T, typename Allocator, typename Function>
+void transform(ArrayList<T, Allocator>& list, Function function,
+               ThreadPool& pool = ThreadPool::shared());
+
+/// Combina init e os elementos com op, que deve ser associativa: os blocos
+/// são reduzidos à parte e depois combinados em ordem com init. Como em
+/// std::reduce, op recebe tanto elementos quanto resultados parciais, então
+/// init e o resultado são do tipo dos elementos
+template<typename T, typename Allocator, typename Operation>
+T reduce(const ArrayList<T, Allocator>& list,
+         typename ArrayList<T, Allocator>::value_type init, Operation op,
+         ThreadPool& pool = ThreadPool::shared());
+
+namespace detail {
+
+/// Abaixo disso por bloco, dividir custa mais do que ganha
+constexpr std::size_t MIN_GRAIN = 4096;
+/// Elementos entre consultas ao resultado de find_first
+constexpr std::size_t CANCEL_STRIDE = 1024;
+
+/// Quantidade de blocos para n elementos
+inline std::size_t chunks(std::size_t n, const ThreadPool& pool) {
+    std::size_t by_size = (n + MIN_GRAIN - 1) / MIN_GRAIN;
+    std::size_t by_threads = pool.concurrency();
+    std::size_t k = by_size < by_threads ? by_size : by_threads;
+    return k > 0 ? k : 1;
+}
+
+/// Início do bloco i de k sobre n elementos (blocos quase iguais)
+inline std::size_t chunk_begin(std::size_t i, std::size_t k, std::size_t n) {
+    return n / k * i + (i < n % k ? i : n % k);
+}
+
+/// Quantos dos r primeiros elementos da intercalação estável de left e
+/// right vêm de left (busca binária; nos empates left vem antes)
+template<typename T, typename Compare>
+std::size_t merge_split(std::size_t r, const T* left, std::size_t left_size,
+                        const T* right, std::size_t right_size,
+                        Compare& compare) {
+    std::size_t low = r > right_size ? r - right_size : 0;
+    std::size_t high = r < left_size ? r : left_size;
+    while (low < high) {
+        std::size_t a = low + (high - low) / 2;
+        // right[r - a - 1] só vem antes de left[a] se for menor.
+        if (compare(right[r - a - 1], left[a])) {
+            high = a;
+        } else {
+            low = a + 1;
+        }
+    }
+    return low;
+}
+
+/// Vetor auxiliar do tamanho da lista, com k blocos construídos (e
+/// destruídos) em paralelo a partir dos blocos da lista
+template<typename T>
+class MergeBuffer {
+ public:
+    MergeBuffer(T* source, std::size_t n, std::size_t k, ThreadPool& pool):
+        data_{std::allocator<T>().allocate(n)},
+        n_{n},
+        built_(k, 0)
+    {
+        try {
+            pool.parallel_for(k, [&](std::size_t i) {
+                std::uninitialized_copy(
+                    std::make_move_iterator(source + chunk_begin(i, k, n)),
+                    std::make_move_iterator(source + chunk_begin(i + 1, k, n)),
+                    data_ + chunk_begin(i, k, n));
+                built_[i] = 1;
+            });
+        } catch (...) {
+            destroy_built();
+            throw;
+        }
+    }
+    ~MergeBuffer() {
+        destroy_built();
+    }
+    MergeBuffer(const MergeBuffer&) = delete;
+    MergeBuffer& operator=(const MergeBuffer&) = delete;
+
+    T* data() {
+        return data_;
+    }
+    /// Destrói os blocos em paralelo
+    void destroy(ThreadPool& pool) {
+        std::size_t k = built_.size();
+        pool.parallel_for(k, [&](std::size_t i) {
+            for (std::size_t j = chunk_begin(i, k, n_);
+                 j < chunk_begin(i + 1, k, n_); j++) {
+                data_[j].~T();
+            }
+            built_[i] = 0;
+        });
+    }
+
+ private:
+    void destroy_built() {
+        std::size_t k = built_.size();
+        for (std::size_t i = 0; i < k; i++) {
+            if (built_[i]) {
+                for (std::size_t j = chunk_begin(i, k, n_);
+                     j < chunk_begin(i + 1, k, n_); j++) {
+                    data_[j].~T();
+                }
+            }
+        }
+        std::allocator<T>().deallocate(data_, n_);
+    }
+
+    T* data_;
+    std::size_t n_;
+    /// Um byte por bloco (e não vector<bool>): cada tarefa escreve o seu
+    std::vector<char> built_;
+};
+
+}  // namespace detail
+
+}  // namespace parallel
+
+}  // namespace structures
+
+template<typename T, typename Allocator, typename Compare>
+void structures::parallel::stable_sort(ArrayList<T, Allocator>& list,
+                                       Compare compare, ThreadPool& pool) {
+    std::size_t n = list.size();
+    std::size_t k = detail::chunks(n, pool);
+    T* data = list.begin();
+    // Cada bloco é ordenado sozinho.
+    pool.parallel_for(k, [&](std::size_t i) {
+        std::stable_sort(data + detail::chunk_begin(i, k, n),
+                         data + detail::chunk_begin(i + 1, k, n), compare);
+    });
+    if (k == 1) {
+        return;
+    }
+    // Depois, rodadas de intercalação dos pares vizinhos, alternando entre
+    // a lista e um vetor auxiliar. Em toda rodada cada uma das k tarefas
+    // produz um bloco da saída: uma busca binária acha quanto dele vem de
+    // cada metade do par, e std::merge, que prefere a esquerda nos empates,
+    // mantém a ordenação estável.
+    detail::MergeBuffer<T> buffer(data, n, k, pool);
+    T* from = buffer.data();
+    T* to = data;
+    // splits[j]: quantos elementos da metade esquerda vão antes do bloco j
+    std::vector<std::size_t> splits(k);
+    for (std::size_t width = 1; width < k; width *= 2) {
+        auto pair_of = [&](std::size_t j, std::size_t& begin,
+                           std::size_t& split, std::size_t& end) {
+            std::size_t first = j / (2 * width) * (2 * width);
+            std::size_t middle = first + width < k ? first + width : k;
+            std::size_t last = middle + width < k ? middle + width : k;
+            begin = detail::chunk_begin(first, k, n);
+            split = detail::chunk_begin(middle, k, n);
+            end = detail::chunk_begin(last, k, n);
+        };
+        // Só lê: nenhuma tarefa move elementos enquanto outras comparam.
+        pool.parallel_for(k, [&](std::size_t j) {
+            std::size_t begin, split, end;
+            pair_of(j, begin, split, end);
+            splits[j] = detail::merge_split(
+                detail::chunk_begin(j, k, n) - begin, from + begin,
+                split - begin, from + split, end - split, compare);
+        });
+        pool.parallel_for(k, [&](std::size_t j) {
+            std::size_t begin, split, end;
+            pair_of(j, begin, split, end);
+            std::size_t low = detail::chunk_begin(j, k, n) - begin;
+            std::size_t high = detail::chunk_begin(j + 1, k, n) - begin;
+            std::size_t left_low = splits[j];
+            std::size_t left_high = detail::chunk_begin(j + 1, k, n) < end ?
+                                    splits[j + 1] : split - begin;
+            std::merge(std::make_move_iterator(from + begin + left_low),
+                       std::make_move_iterator(from + begin + left_high),
+                       std::make_move_iterator(from + split + low - left_low),
+                       std::make_move_iterator(from + split + high -
+                                               left_high),
+                       to + begin + low, compare);
+        });
+        std::swap(from, to);
+    }
+    if (from != data) {
+        pool.parallel_for(k, [&](std::size_t i) {
+            std::size_t begin = detail::chunk_begin(i, k, n);
+            std::size_t end = detail::chunk_begin(i + 1, k, n);
+            std::move(from + begin, from + end, data + begin);
+        });
+    }
+    buffer.destroy(pool);
+}
+
+template<typename T, typename Allocator, typename Predicate>
+std::size_t structures::parallel::find_first(
+        const ArrayList<T, Allocator>& list, Predicate pred, ThreadPool& pool) {
+    std::size_t n = list.size();
+    std::size_t k = detail::chunks(n, pool);
+    const T* data = list.begin();
+    std::atomic<std::size_t> found(n);
+    pool.parallel_for(k, [&](std::size_t i) {
+        std::size_t begin = detail::chunk_begin(i, k, n);
+        std::size_t end = detail::chunk_begin(i + 1, k, n);
+        for (std::size_t j = begin; j < end;) {
+            // Um bloco anterior já achou: nada aqui pode ser o primeiro.
+            if (found.load(std::memory_order_relaxed) < begin) {
+                return;
+            }
+            // Consulta found só a cada trecho, para o laço interno ficar
+            // livre de operações atômicas.
+            std::size_t stop = end - j > detail::CANCEL_STRIDE ?
+                               j + detail::CANCEL_STRIDE : end;
+            for (; j < stop; j++) {
+                if (pred(data[j])) {
+                    std::size_t current =
+                        found.load(std::memory_order_relaxed);
+                    while (j < current &&
+                           !found.compare_exchange_weak(current, j)) {}
+                    return;
+                }
+            }
+        }
+    });
+    return found.load();
+}
+
+template<typename T, typename Allocator, typename Predicate>
+std::size_t structures::parallel::count_if(
+        const ArrayList<T, Allocator>& list, Predicate pred, ThreadPool& pool) {
+    std::size_t n = list.size();
+    std::size_t k = detail::chunks(n, pool);
+    const T* data = list.begin();
+    std::vector<std::size_t> partial(k, 0);
+    pool.parallel_for(k, [&](std::size_t i) {
+        std::size_t count = 0;
+        std::size_t end = detail::chunk_begin(i + 1, k, n);
+        for (std::size_t j = detail::chunk_begin(i, k, n); j < end; j++) {
+            if (pred(data[j])) {
+                count++;
+            }
+        }
+        partial[i] = count;
+    });
+    std::size_t total = 0;
+    for (std::size_t count : partial) {
+        total += count;
+    }
+    return total;
+}
+
+template<typename T, typename Allocator, typename Function>
+void structures::parallel::transform(ArrayList<T, Allocator>& list,
+                                     Function function, ThreadPool& pool) {
+    std::size_t n = list.size();
+    std::size_t k = detail::chunks(n, pool);
+    T* data = list.begin();
+    pool.parallel_for(k, [&](std::size_t i) {
+        std::size_t end = detail::chunk_begin(i + 1, k, n);
+        for (std::size_t j = detail::chunk_begin(i, k, n); j < end; j++) {
+            data[j] = function(data[j]);
+        }
+    });
+}
+
+template<typename T, typename Allocator, typename Operation>
+T structures::parallel::reduce(
+        const ArrayList<T, Allocator>& list,
+        typename ArrayList<T, Allocator>::value_type init, Operation op,
+        ThreadPool& pool) {
+    std::size_t n = list.size();
+    if (n == 0) {
+        return init;
+    }
+    std::size_t k = detail::chunks(n, pool);
+    const T* data = list.begin();
+    // Cada bloco começa do seu primeiro elemento, não de init, para que
+    // init entre uma única vez.
+    std::vector<T> partial;
+    partial.reserve(k);
+    for (std::size_t i = 0; i < k; i++) {
+        partial.emplace_back(data[detail::chunk_begin(i, k, n)]);
+    }
+    pool.parallel_for(k, [&](std::size_t i) {
+        T value = std::move(partial[i]);
+        std::size_t end = detail::chunk_begin(i + 1, k, n);
+        for (std::size_t j = detail::chunk_begin(i, k, n) + 1; j < end; j++) {
+            value = op(std::move(value), data[j]);
+        }
+        partial[i] = std::move(value);
+    });
+    for (std::size_t i = 0; i < k; i++) {
+        init = op(std::move(init), partial[i]);
+    }
+    return init;
+}
+
+#endif
@@ -0,0 +1,224 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_PRIORITY_QUEUE_H
+#define STRUCTURES_PRIORITY_QUEUE_H
+
+#include <cstdint>
+#include <functional>  // std::less
+#include <stdexcept>  // C++ exceptions
+#include <utility>  // std::move
+
+#include "array_list.h"
+
+namespace structures {
+
+/// Fila de prioridade em heap d-ário guardado numa ArrayList.
+/// O topo é o menor elemento segundo Compare, como em PairingHeap;
+/// Arity = 4 deixa os filhos de um nodo mais próximos na memória.
+template<typename T, typename Compare = std::less<T>, std::size_t Arity = 2>
+class PriorityQueue {
+    static_assert(Arity >= 2, "heap precisa de ao menos 2 filhos por nodo");
+
+ public:
+    /// Construtor padrão.
+    PriorityQueue();
+    /// Construtor com capacidade máxima.
+    explicit PriorityQueue(std::size_t max_size);
+    /// Construtor com comparador.
+    explicit PriorityQueue(const Compare& compare);
+    /// Construtor com capacidade máxima e comparador.
+    PriorityQueue(std::size_t max_size, const Compare& compare);
+    /// Constrói a partir de n dados em O(n).
+    PriorityQueue(const T* data, std::size_t n, std::size_t max_size,
+                  const Compare& compare = Compare());
+
+    /// Limpa a fila.
+    void clear();
+    /// Insere em O(log n).
+    void push(const T& data);
+    /// Insere movendo o dado em O(log n).
+    void push(T&& data);
+    /// Retira o topo em O(log n).
+    T pop();
+    /// Elemento de maior prioridade.
+    const T& top() const;
+    /// Cheia.
+    bool full() const;
+    /// Vazia.
+    bool empty() const;
+    /// Tamanho.
+    std::size_t size() const;
+    /// Tamanho máximo.
+    std::size_t max_size() const;
+
+ private:
+    static std::size_t parent(std::size_t index) {
+        return (index - 1) / Arity;
+    }
+    static std::size_t first_child(std::size_t index) {
+        return index * Arity + 1;
+    }
+    /// Sobe o valor a partir do buraco index.
+    void sift_up(std::size_t index, T value);
+    /// Desce o valor a partir do buraco index.
+    void sift_down(std::size_t index, T value);
+    /// Reorganiza todo o vetor em heap (Floyd).
+    void heapify();
+
+    ArrayList<T> contents;
+    Compare compare;
+};
+
+}  // namespace structures
+
+template<typename T, typename Compare, std::size_t Arity>
+structures::PriorityQueue<T, Compare, Arity>::PriorityQueue() {}
+
+template<typename T, typename Compare, std::size_t Arity>
+structures::PriorityQueue<T, Compare, Arity>::PriorityQueue(
+        std::size_t max_size):
+    contents(max_size)
+{}
+
+template<typename T, typename Compare, std::size_t Arity>
+structures::PriorityQueue<T, Compare, Arity>::PriorityQueue(
+        const Compare& compare_):
+    compare(compare_)
+{}
+
+template<typename T, typename Compare, std::size_t Arity>
+structures::PriorityQueue<T, Compare, Arity>::PriorityQueue(
+        std::size_t max_size, const Compare& compare_):
+    contents(max_size),
+    compare(compare_)
+{}
+
+template<typename T, typename Compare, std::size_t Arity>
+structures::PriorityQueue<T, Compare, Arity>::PriorityQueue(
+        const T* data, std::size_t n, std::size_t max_size,
+        const Compare& compare_):
+    contents(max_size),
+    compare(compare_) {
+    for (std::size_t i = 0; i < n; i++) {
+        contents.push_back(data[i]);
+    }
+    heapify();
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void structures::PriorityQueue<T, Compare, Arity>::clear() {
+    contents.clear();
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void structures::PriorityQueue<T, Compare, Arity>::push(const T& data) {
+    push(T(data));
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void structures::PriorityQueue<T, Compare, Arity>::push(T&& data) {
+    if (full()) {
+        throw std::out_of_range("fila cheia");
+    }
+    // Abre um buraco no fim e sobe o dado até sua posição.
+    T& hole = contents.emplace_back(std::move(data));
+    T value = std::move(hole);
+    sift_up(contents.size() - 1, std::move(value));
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+T structures::PriorityQueue<T, Compare, Arity>::pop() {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    }
+    T last = contents.pop_back();
+    if (contents.empty()) {
+        return last;
+    }
+    T result = std::move(contents[0]);
+    sift_down(0, std::move(last));
+    return result;
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+const T& structures::PriorityQueue<T, Compare, Arity>::top() const {
+    if (empty()) {
+        throw std::out_of_range("fila vazia");
+    }
+    return contents[0];
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+bool structures::PriorityQueue<T, Compare, Arity>::full() const {
+    return contents.full();
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+bool structures::PriorityQueue<T, Compare, Arity>::empty() const {
+    return contents.empty();
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+std::size_t structures::PriorityQueue<T, Compare, Arity>::size() const {
+    return contents.size();
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+std::size_t structures::PriorityQueue<T, Compare, Arity>::max_size() const {
+    return contents.max_size();
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void structures::PriorityQueue<T, Compare, Arity>::sift_up(std::size_t index,
+                                                           T value) {
+    while (index > 0) {
+        std::size_t up = parent(index);
+        if (!compare(value, contents[up])) {
+            break;
+        }
+        contents[index] = std::move(contents[up]);
+        index = up;
+    }
+    contents[index] = std::move(value);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void structures::PriorityQueue<T, Compare, Arity>::sift_down(
+        std::size_t index, T value) {
+    std::size_t n = contents.size();
+    while (true) {
+        std::size_t child = first_child(index);
+        if (child >= n) {
+            break;
+        }
+        // Escolhe o filho de maior prioridade.
+        std::size_t last = child + Arity < n ? child + Arity : n;
+        std::size_t best = child;
+        for (std::size_t i = child + 1; i < last; i++) {
+            if (compare(contents[i], contents[best])) {
+                best = i;
+            }
+        }
+        if (!compare(contents[best], value)) {
+            break;
+        }
+        contents[index] = std::move(contents[best]);
+        index = best;
+    }
+    contents[index] = std::move(value);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void structures::PriorityQueue<T, Compare, Arity>::heapify() {
+    std::size_t n = contents.size();
+    if (n < 2) {
+        return;
+    }
+    std::size_t index = parent(n - 1) + 1;
+    while (index > 0) {
+        index--;
+        T value = std::move(contents[index]);
+        sift_down(index, std::move(value));
+    }
+}
+
+#endif
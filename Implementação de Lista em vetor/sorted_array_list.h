@@ -0,0 +1,252 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_SORTED_ARRAY_LIST_H
+#define STRUCTURES_SORTED_ARRAY_LIST_H
+
+#include <cstdint>
+#include <functional>  // std::less
+#include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_arithmetic
+#include <utility>  // std::move, std::pair
+
+#include "array_list.h"
+
+namespace structures {
+
+/// Lista em vetor sempre ordenada segundo Compare. As buscas são binárias
+/// e a inserção desloca os elementos num único bloco.
+template<typename T, typename Compare = std::less<T>>
+class SortedArrayList {
+ public:
+    /// Lista que cresce sob demanda
+    SortedArrayList();
+    /// Lista de capacidade fixa
+    explicit SortedArrayList(std::size_t max_size);
+
+    void clear();
+    /// Insere mantendo a ordem (após os iguais); devolve a posição
+    std::size_t insert(const T& data);
+    /// Insere movendo o dado; devolve a posição
+    std::size_t insert(T&& data);
+    T pop(std::size_t index);
+    T pop_back();
+    T pop_front();
+    /// Retira o primeiro igual a data
+    void remove(const T& data);
+    /// Primeira posição cujo dado não é menor que data, em O(log n)
+    std::size_t lower_bound(const T& data) const;
+    /// Primeira posição cujo dado é maior que data, em O(log n)
+    std::size_t upper_bound(const T& data) const;
+    /// Intervalo [first, second) dos iguais a data
+    std::pair<std::size_t, std::size_t> equal_range(const T& data) const;
+    bool contains(const T& data) const;
+    /// Posição do primeiro igual a data, ou size() se não houver
+    std::size_t find(const T& data) const;
+    std::size_t count(const T& data) const;
+    bool full() const;
+    bool empty() const;
+    std::size_t size() const;
+    std::size_t max_size() const;
+    void reserve(std::size_t n);
+    /// Somente leitura: alterar um dado quebraria a ordem
+    const T& at(std::size_t index) const;
+    const T& operator[](std::size_t index) const;
+
+ private:
+    /// Primeira posição p tal que before(contents[p]) é falso, sabendo
+    /// que before é verdadeiro num prefixo da lista
+    template<typename Before>
+    std::size_t partition_point(Before before) const;
+    /// Versão sem desvios, para tipos aritméticos
+    template<typename Before>
+    std::size_t partition_point(Before before, std::true_type) const;
+    /// Versão comum
+    template<typename Before>
+    std::size_t partition_point(Before before, std::false_type) const;
+
+    ArrayList<T> contents;
+    Compare compare;
+};
+
+}  // namespace structures
+
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList() {}
+
+template<typename T, typename Compare>
+structures::SortedArrayList<T, Compare>::SortedArrayList(
+        std::size_t max_size):
+    contents(max_size)
+{}
+
+template<typename T, typename Compare>
+void structures::SortedArrayList<T, Compare>::clear() {
+    contents.clear();
+}
+
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::insert(const T& data) {
+    std::size_t position = upper_bound(data);
+    contents.insert(data, position);
+    return position;
+}
+
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::insert(T&& data) {
+    std::size_t position = upper_bound(data);
+    contents.insert(std::move(data), position);
+    return position;
+}
+
+template<typename T, typename Compare>
+T structures::SortedArrayList<T, Compare>::pop(std::size_t index) {
+    return contents.pop(index);
+}
+
+template<typename T, typename Compare>
+T structures::SortedArrayList<T, Compare>::pop_back() {
+    return contents.pop_back();
+}
+
+template<typename T, typename Compare>
+T structures::SortedArrayList<T, Compare>::pop_front() {
+    return contents.pop_front();
+}
+
+template<typename T, typename Compare>
+void structures::SortedArrayList<T, Compare>::remove(const T& data) {
+    if (empty()) {
+        throw std::out_of_range("lista vazia");
+    }
+    std::size_t position = find(data);
+    if (position == size()) {
+        throw std::out_of_range("posicao invalida");
+    }
+    contents.pop(position);
+}
+
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::lower_bound(
+        const T& data) const {
+    const Compare& less = compare;
+    return partition_point([&less, &data](const T& x) {
+        return less(x, data);
+    });
+}
+
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::upper_bound(
+        const T& data) const {
+    const Compare& less = compare;
+    return partition_point([&less, &data](const T& x) {
+        return !less(data, x);
+    });
+}
+
+template<typename T, typename Compare>
+std::pair<std::size_t, std::size_t>
+structures::SortedArrayList<T, Compare>::equal_range(const T& data) const {
+    return std::make_pair(lower_bound(data), upper_bound(data));
+}
+
+template<typename T, typename Compare>
+bool structures::SortedArrayList<T, Compare>::contains(const T& data) const {
+    return find(data) != size();
+}
+
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::find(
+        const T& data) const {
+    std::size_t position = lower_bound(data);
+    if (position < size() && !compare(data, contents[position])) {
+        return position;
+    }
+    return size();
+}
+
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::count(
+        const T& data) const {
+    return upper_bound(data) - lower_bound(data);
+}
+
+template<typename T, typename Compare>
+bool structures::SortedArrayList<T, Compare>::full() const {
+    return contents.full();
+}
+
+template<typename T, typename Compare>
+bool structures::SortedArrayList<T, Compare>::empty() const {
+    return contents.empty();
+}
+
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::size() const {
+    return contents.size();
+}
+
+template<typename T, typename Compare>
+std::size_t structures::SortedArrayList<T, Compare>::max_size() const {
+    return contents.max_size();
+}
+
+template<typename T, typename Compare>
+void structures::SortedArrayList<T, Compare>::reserve(std::size_t n) {
+    contents.reserve(n);
+}
+
+template<typename T, typename Compare>
+const T& structures::SortedArrayList<T, Compare>::at(
+        std::size_t index) const {
+    return contents.at(index);
+}
+
+template<typename T, typename Compare>
+const T& structures::SortedArrayList<T, Compare>::operator[](
+        std::size_t index) const {
+    return contents[index];
+}
+
+template<typename T, typename Compare>
+template<typename Before>
+std::size_t structures::SortedArrayList<T, Compare>::partition_point(
+        Before before) const {
+    if (empty()) {
+        return 0;
+    }
+    return partition_point(before, std::is_arithmetic<T>());
+}
+
+template<typename T, typename Compare>
+template<typename Before>
+std::size_t structures::SortedArrayList<T, Compare>::partition_point(
+        Before before, std::true_type) const {
+    // O laço só depende de n; a escolha da metade vira um cmov.
+    const T* first = &contents[0];
+    const T* base = first;
+    std::size_t n = size();
+    while (n > 1) {
+        std::size_t half = n / 2;
+        base = before(base[half]) ? base + half : base;
+        n -= half;
+    }
+    return (base - first) + (before(*base) ? 1 : 0);
+}
+
+template<typename T, typename Compare>
+template<typename Before>
+std::size_t structures::SortedArrayList<T, Compare>::partition_point(
+        Before before, std::false_type) const {
+    std::size_t low = 0;
+    std::size_t high = size();
+    while (low < high) {
+        std::size_t middle = low + (high - low) / 2;
+        if (before(contents[middle])) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+#endif
@@ -0,0 +1,72 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_array_list.cpp
+
+#include "gtest/gtest.h"
+// Todos os cabeçalhos do diretório juntos, alguns mais de uma vez, para
+// garantir que as definições ficam dentro das guardas de inclusão.
+#include "array_list.h"
+#include "simd_search.h"
+#include "priority_queue.h"
+#include "sorted_array_list.h"
+#include "pairing_heap.h"
+#include "thread_pool.h"
+#include "parallel_algorithms.h"
+#include "array_list.h"
+#include "priority_queue.h"
+#include "sorted_array_list.h"
+#include "../tests_memory_resource.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#if __cplusplus >= 202002L
+// Os iteradores satisfazem o conceito de std::ranges esperado.
+static_assert(std::ranges::contiguous_range<structures::ArrayList<int>>);
+static_assert(std::ranges::contiguous_range<const structures::ArrayList<int>>);
+#endif
+
+TEST(HeadersTest, IncludedTogether) {
+    structures::ArrayList<int> list;
+    for (auto i = 0; i < 10; ++i) {
+        list.push_back(9 - i);
+    }
+    structures::PriorityQueue<int> queue;
+    structures::SortedArrayList<int> sorted;
+    for (auto data : list) {
+        queue.push(data);
+        sorted.insert(data);
+    }
+    structures::parallel::stable_sort(list);
+    for (auto i = 0u; i < 10u; ++i) {
+        ASSERT_EQ(static_cast<int>(i), list.at(i));
+        ASSERT_EQ(static_cast<int>(i), sorted.at(i));
+    }
+    ASSERT_EQ(0, queue.pop());
+}
+
+#if __cplusplus >= 201703L
+TEST(ArrayListAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::ArrayList<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.push_back(std::move(value));
+        },
+        [](C& list, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_EQ(tests::long_value(i), list.at(i));
+            }
+        });
+}
+#endif
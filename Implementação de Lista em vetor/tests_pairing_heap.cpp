@@ -0,0 +1,166 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_pairing_heap.cpp
+
+#include "gtest/gtest.h"
+#include "pairing_heap.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+/// Comparador com estado: ordena pela distância até center.
+struct CloserTo {
+    explicit CloserTo(int center_): center{center_} {}
+    bool operator()(int a, int b) const {
+        return std::abs(a - center) < std::abs(b - center);
+    }
+    int center;
+};
+
+}  // namespace
+
+TEST(PairingHeapTest, PopsSmallestFirst) {
+    std::srand(11);
+    std::vector<int> data;
+    structures::PairingHeap<int> heap;
+    for (auto i = 0; i < 1000; ++i) {
+        data.push_back(std::rand() % 500);
+        heap.push(data.back());
+    }
+    ASSERT_EQ(1000u, heap.size());
+    std::sort(data.begin(), data.end());
+    for (auto expected : data) {
+        ASSERT_EQ(expected, heap.top());
+        ASSERT_EQ(expected, heap.pop());
+    }
+    ASSERT_TRUE(heap.empty());
+    ASSERT_THROW(heap.pop(), std::out_of_range);
+    ASSERT_THROW(heap.top(), std::out_of_range);
+}
+
+TEST(PairingHeapTest, DecreaseKey) {
+    structures::PairingHeap<int> heap;
+    std::vector<structures::PairingHeap<int>::Handle> handles;
+    for (auto i = 0; i < 10; ++i) {
+        handles.push_back(heap.push(10 + i));
+    }
+    heap.decrease_key(handles[7], 1);
+    ASSERT_EQ(1, heap.top());
+    ASSERT_EQ(1, heap.value(handles[7]));
+    heap.decrease_key(handles[3], 5);
+    ASSERT_THROW(heap.decrease_key(handles[3], 50), std::invalid_argument);
+    ASSERT_EQ(1, heap.pop());
+    ASSERT_EQ(5, heap.pop());
+    ASSERT_EQ(10, heap.pop());
+    ASSERT_EQ(7u, heap.size());
+}
+
+TEST(PairingHeapTest, Erase) {
+    structures::PairingHeap<std::string> heap;
+    auto b = heap.push("b");
+    heap.push("a");
+    heap.push("c");
+    auto d = heap.push("d");
+    heap.pop();
+    heap.erase(d);
+    heap.erase(b);
+    ASSERT_EQ(1u, heap.size());
+    ASSERT_EQ("c", heap.pop());
+    auto e = heap.push("e");
+    heap.erase(e);
+    ASSERT_TRUE(heap.empty());
+}
+
+TEST(PairingHeapTest, MeldKeepsHandles) {
+    structures::PairingHeap<int> heap;
+    structures::PairingHeap<int> other;
+    for (auto i = 0; i < 5; ++i) {
+        heap.push(2 * i);
+    }
+    auto handle = other.push(100);
+    for (auto i = 0; i < 5; ++i) {
+        other.push(2 * i + 1);
+    }
+    heap.meld(other);
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(11u, heap.size());
+    heap.decrease_key(handle, -1);
+    ASSERT_EQ(-1, heap.pop());
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, heap.pop());
+    }
+    // other continua utilizável depois de ceder seus nodos.
+    other.push(3);
+    ASSERT_EQ(3, other.pop());
+}
+
+TEST(PairingHeapTest, StatefulComparator) {
+    structures::PairingHeap<int, CloserTo> heap{CloserTo(10)};
+    for (auto data : {0, 20, 13, 9, 4}) {
+        heap.push(data);
+    }
+    ASSERT_EQ(9, heap.pop());
+    ASSERT_EQ(13, heap.pop());
+    ASSERT_EQ(4, heap.pop());
+}
+
+TEST(PairingHeapTest, MeldSplicesEveryChunk) {
+    // Cada heap cede vários blocos; o destino libera todos no fim.
+    structures::PairingHeap<std::string> heap;
+    for (auto round = 0; round < 50; ++round) {
+        structures::PairingHeap<std::string> other;
+        for (auto i = 0; i < 40; ++i) {
+            other.push(std::to_string(1000 + round * 40 + i));
+        }
+        heap.meld(other);
+        // other volta a alocar um bloco novo, que também vai para heap.
+        other.push(std::to_string(round));
+        heap.meld(other);
+    }
+    ASSERT_EQ(50u * 41u, heap.size());
+    std::string previous = heap.pop();
+    while (!heap.empty()) {
+        std::string current = heap.pop();
+        ASSERT_LE(previous, current);
+        previous = current;
+    }
+}
+
+TEST(PairingHeapTest, MoveKeepsHandles) {
+    using Heap = structures::PairingHeap<int, CloserTo>;
+    static_assert(std::is_nothrow_move_constructible<Heap>::value &&
+                  std::is_nothrow_move_assignable<Heap>::value,
+                  "movimento nao deve lancar");
+    Heap heap{CloserTo(10)};
+    std::vector<Heap::Handle> handles;
+    for (auto i = 0; i < 100; ++i) {
+        handles.push_back(heap.push(i));
+    }
+    Heap moved(std::move(heap));
+    ASSERT_TRUE(heap.empty());
+    ASSERT_EQ(100u, moved.size());
+    // O comparador com estado vai junto, e os handles seguem valendo.
+    ASSERT_EQ(10, moved.top());
+    moved.decrease_key(handles[50], 10);
+    ASSERT_EQ(10, moved.pop());
+    ASSERT_EQ(10, moved.pop());
+    heap.push(7);
+    moved = std::move(heap);
+    ASSERT_TRUE(heap.empty());
+    ASSERT_EQ(1u, moved.size());
+    ASSERT_EQ(7, moved.pop());
+    heap.push(3);
+    ASSERT_EQ(3, heap.pop());
+}
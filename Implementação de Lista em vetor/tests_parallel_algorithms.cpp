@@ -0,0 +1,219 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_parallel_algorithms.cpp
+
+#include "gtest/gtest.h"
+#include "parallel_algorithms.h"
+#include "parallel_algorithms.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+namespace detail = structures::parallel::detail;
+
+/// Lista com 0, 1, ..., n - 1
+structures::ArrayList<long> iota(std::size_t n) {
+    structures::ArrayList<long> list;
+    for (std::size_t i = 0; i < n; ++i) {
+        list.push_back(static_cast<long>(i));
+    }
+    return list;
+}
+
+/// Posições de interesse: o início, o fim e as bordas de cada bloco
+std::vector<std::size_t> boundaries(std::size_t n,
+                                    const structures::ThreadPool& pool) {
+    std::size_t k = detail::chunks(n, pool);
+    std::vector<std::size_t> result;
+    for (std::size_t i = 0; i <= k; ++i) {
+        std::size_t begin = detail::chunk_begin(i, k, n);
+        if (begin > 0) {
+            result.push_back(begin - 1);
+        }
+        if (begin < n) {
+            result.push_back(begin);
+        }
+    }
+    return result;
+}
+
+/// Com 4 threads, quatro blocos de tamanhos diferentes
+const std::size_t N = 100003;
+
+}  // namespace
+
+TEST(ParallelAlgorithmsTest, SplitsIntoSeveralChunks) {
+    structures::ThreadPool pool(3);
+    ASSERT_EQ(4u, detail::chunks(N, pool));
+    ASSERT_EQ(1u, detail::chunks(10, pool));
+    ASSERT_EQ(0u, detail::chunk_begin(0, 4, N));
+    ASSERT_EQ(N, detail::chunk_begin(4, 4, N));
+}
+
+TEST(ParallelAlgorithmsTest, FindFirstAcrossChunkBoundaries) {
+    structures::ThreadPool pool(3);
+    auto list = iota(N);
+    for (auto position : boundaries(N, pool)) {
+        long target = static_cast<long>(position);
+        ASSERT_EQ(position, structures::parallel::find_first(
+            list, [target](long x) { return x == target; }, pool));
+    }
+    ASSERT_EQ(N, structures::parallel::find_first(
+        list, [](long x) { return x < 0; }, pool));
+    // Vários blocos acham: vale o de menor posição.
+    ASSERT_EQ(25001u, structures::parallel::find_first(
+        list, [](long x) { return x > 25000 && x % 2 == 1; }, pool));
+    structures::ArrayList<long> empty;
+    ASSERT_EQ(0u, structures::parallel::find_first(
+        empty, [](long) { return true; }, pool));
+}
+
+TEST(ParallelAlgorithmsTest, CountIf) {
+    structures::ThreadPool pool(3);
+    auto list = iota(N);
+    auto multiple_of_7 = [](long x) { return x % 7 == 0; };
+    ASSERT_EQ(std::size_t(std::count_if(list.begin(), list.end(),
+                                        multiple_of_7)),
+              structures::parallel::count_if(list, multiple_of_7, pool));
+    ASSERT_EQ(N, structures::parallel::count_if(
+        list, [](long) { return true; }, pool));
+    ASSERT_EQ(0u, structures::parallel::count_if(
+        list, [](long) { return false; }, pool));
+}
+
+TEST(ParallelAlgorithmsTest, TransformEveryElement) {
+    structures::ThreadPool pool(3);
+    auto list = iota(N);
+    structures::parallel::transform(list, [](long x) { return 2 * x + 1; },
+                                    pool);
+    for (std::size_t i = 0; i < N; ++i) {
+        ASSERT_EQ(2 * static_cast<long>(i) + 1, list.at(i));
+    }
+}
+
+TEST(ParallelAlgorithmsTest, ReduceUsesInitOnce) {
+    structures::ThreadPool pool(3);
+    auto list = iota(N);
+    long n = static_cast<long>(N);
+    // init é int, convertido para o tipo dos elementos.
+    ASSERT_EQ(1000 + n * (n - 1) / 2, structures::parallel::reduce(
+        list, 1000, [](long a, long b) { return a + b; }, pool));
+    ASSERT_EQ(n - 1, structures::parallel::reduce(
+        list, -1, [](long a, long b) { return std::max(a, b); }, pool));
+    structures::ArrayList<long> empty;
+    ASSERT_EQ(7, structures::parallel::reduce(
+        empty, 7, [](long a, long b) { return a + b; }, pool));
+}
+
+TEST(ParallelAlgorithmsTest, ReduceKeepsOrderForNonCommutativeOp) {
+    structures::ThreadPool pool(3);
+    structures::ArrayList<std::string> list;
+    std::string expected = "<";
+    // Menos elementos: cada passo copia o texto acumulado.
+    std::size_t n = 20011;
+    ASSERT_EQ(4u, detail::chunks(n, pool));
+    for (std::size_t i = 0; i < n; ++i) {
+        list.push_back(std::string(1, static_cast<char>('a' + i % 26)));
+        expected += list.at(i);
+    }
+    auto concat = [](const std::string& a, const std::string& b) {
+        return a + b;
+    };
+    ASSERT_EQ(expected, structures::parallel::reduce(list, "<", concat, pool));
+}
+
+TEST(ParallelAlgorithmsTest, StableSortAcrossChunks) {
+    using Pair = std::pair<int, std::size_t>;
+    structures::ThreadPool pool(3);
+    structures::ArrayList<Pair> list;
+    for (std::size_t i = 0; i < N; ++i) {
+        list.push_back(Pair(static_cast<int>((i * 7919) % 100), i));
+    }
+    structures::parallel::stable_sort(list, [](const Pair& a, const Pair& b) {
+        return a.first < b.first;
+    }, pool);
+    for (std::size_t i = 1; i < N; ++i) {
+        ASSERT_LE(list.at(i - 1).first, list.at(i).first);
+        if (list.at(i - 1).first == list.at(i).first) {
+            ASSERT_LT(list.at(i - 1).second, list.at(i).second);
+        }
+    }
+}
+
+TEST(ParallelAlgorithmsTest, StableSortMatchesStdForAnyChunkCount) {
+    // Rodadas com pares completos e com um bloco sobrando; muitos empates
+    // e blocos que caem inteiros de um lado da intercalação.
+    using Pair = std::pair<std::string, std::size_t>;
+    auto by_key = [](const Pair& a, const Pair& b) {
+        return a.first < b.first;
+    };
+    std::size_t n = 8 * detail::MIN_GRAIN + 17;
+    for (std::size_t threads = 0; threads < 8; ++threads) {
+        structures::ThreadPool pool(threads);
+        ASSERT_EQ(threads + 1, detail::chunks(n, pool));
+        structures::ArrayList<Pair> list(n);
+        std::vector<Pair> expected;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t key = i < n / 2 ? (i * 7919) % 37 : 40 + i % 3;
+            Pair pair(std::to_string(key), i);
+            list.push_back(pair);
+            expected.push_back(pair);
+        }
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+        structures::parallel::stable_sort(list, by_key, pool);
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(),
+                               list.begin()));
+    }
+}
+
+TEST(ParallelAlgorithmsTest, StableSortThrowingCompare) {
+    structures::ThreadPool pool(3);
+    auto fill = [](structures::ArrayList<std::string>& list) {
+        for (std::size_t i = 0; i < N; ++i) {
+            list.push_back(std::to_string((i * 7919) % N));
+        }
+    };
+    std::atomic<long> calls{0};
+    long limit = -1;
+    auto compare = [&](const std::string& a, const std::string& b) {
+        if (calls.fetch_add(1) == limit) {
+            throw std::runtime_error("falha");
+        }
+        return a < b;
+    };
+    structures::ArrayList<std::string> counted(N);
+    fill(counted);
+    structures::parallel::stable_sort(counted, compare, pool);
+    // Lança na última rodada de intercalação; o vetor auxiliar é liberado.
+    limit = calls.load() - 1000;
+    calls.store(0);
+    structures::ArrayList<std::string> list(N);
+    fill(list);
+    ASSERT_THROW(structures::parallel::stable_sort(list, compare, pool),
+                 std::runtime_error);
+    ASSERT_EQ(N, list.size());
+}
+
+TEST(ParallelAlgorithmsTest, SerialPoolAndExceptions) {
+    structures::ThreadPool serial(0);
+    auto list = iota(N);
+    ASSERT_EQ(N, structures::parallel::count_if(
+        list, [](long) { return true; }, serial));
+    structures::ThreadPool pool(3);
+    ASSERT_THROW(structures::parallel::transform(list, [](long x) {
+        if (x == 75000) {
+            throw std::runtime_error("falha");
+        }
+        return x;
+    }, pool), std::runtime_error);
+}
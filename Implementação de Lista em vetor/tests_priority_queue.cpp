@@ -0,0 +1,93 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_priority_queue.cpp
+
+#include "gtest/gtest.h"
+#include "priority_queue.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+/// Comparador com estado: ordena pela distância até center.
+struct CloserTo {
+    explicit CloserTo(int center_): center{center_} {}
+    bool operator()(int a, int b) const {
+        return std::abs(a - center) < std::abs(b - center);
+    }
+    int center;
+};
+
+}  // namespace
+
+TEST(PriorityQueueTest, PopsSmallestFirst) {
+    structures::PriorityQueue<int> queue;
+    for (auto data : {5, 3, 8, 1, 9, 2}) {
+        queue.push(data);
+    }
+    ASSERT_EQ(1, queue.top());
+    for (auto data : {1, 2, 3, 5, 8, 9}) {
+        ASSERT_EQ(data, queue.pop());
+    }
+    ASSERT_TRUE(queue.empty());
+    ASSERT_THROW(queue.pop(), std::out_of_range);
+    ASSERT_THROW(queue.top(), std::out_of_range);
+}
+
+TEST(PriorityQueueTest, GreaterMakesMaxHeap) {
+    structures::PriorityQueue<std::string, std::greater<std::string>> queue;
+    queue.push("b");
+    queue.push("c");
+    queue.push("a");
+    ASSERT_EQ("c", queue.pop());
+    ASSERT_EQ("b", queue.pop());
+    ASSERT_EQ("a", queue.pop());
+}
+
+TEST(PriorityQueueTest, FourAryRandomOrder) {
+    std::srand(7);
+    std::vector<int> data;
+    structures::PriorityQueue<int, std::less<int>, 4> queue{1000u};
+    for (auto i = 0; i < 1000; ++i) {
+        data.push_back(std::rand() % 500);
+        queue.push(data.back());
+    }
+    ASSERT_TRUE(queue.full());
+    ASSERT_THROW(queue.push(0), std::out_of_range);
+    std::sort(data.begin(), data.end());
+    for (auto expected : data) {
+        ASSERT_EQ(expected, queue.pop());
+    }
+}
+
+TEST(PriorityQueueTest, HeapifyFromArray) {
+    int data[] = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
+    structures::PriorityQueue<int, std::less<int>, 3> queue{data, 10, 10};
+    ASSERT_EQ(10u, queue.size());
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(i, queue.pop());
+    }
+}
+
+TEST(PriorityQueueTest, StatefulComparator) {
+    structures::PriorityQueue<int, CloserTo> queue{CloserTo(10)};
+    for (auto data : {0, 20, 13, 9, 4}) {
+        queue.push(data);
+    }
+    ASSERT_EQ(9, queue.pop());
+    ASSERT_EQ(13, queue.pop());
+    ASSERT_EQ(4, queue.pop());
+    int data[] = {1, 6, 3};
+    structures::PriorityQueue<int, CloserTo> built{data, 3, 3, CloserTo(5)};
+    ASSERT_EQ(6, built.pop());
+    ASSERT_EQ(3, built.pop());
+}
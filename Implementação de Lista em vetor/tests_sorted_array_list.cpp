@@ -0,0 +1,148 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_sorted_array_list.cpp
+
+#include "gtest/gtest.h"
+#include "sorted_array_list.h"
+#include "sorted_array_list.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+namespace {
+
+/// Compara a lista com um vetor ordenado de referência.
+template<typename List, typename T>
+void expect_same(const List& list, const std::vector<T>& expected) {
+    ASSERT_EQ(expected.size(), list.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], list[i]);
+    }
+}
+
+}  // namespace
+
+TEST(SortedArrayListTest, EmptyList) {
+    structures::SortedArrayList<int> list;
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(0u, list.lower_bound(1));
+    ASSERT_EQ(0u, list.upper_bound(1));
+    ASSERT_EQ(0u, list.find(1));
+    ASSERT_FALSE(list.contains(1));
+    ASSERT_EQ(0u, list.count(1));
+    ASSERT_THROW(list.remove(1), std::out_of_range);
+    ASSERT_THROW(list.pop_back(), std::out_of_range);
+    ASSERT_THROW(list.at(0), std::out_of_range);
+}
+
+TEST(SortedArrayListTest, InsertKeepsOrderAndReturnsPosition) {
+    structures::SortedArrayList<int> list;
+    ASSERT_EQ(0u, list.insert(5));
+    ASSERT_EQ(0u, list.insert(1));
+    ASSERT_EQ(2u, list.insert(9));
+    ASSERT_EQ(2u, list.insert(5));  // Após o 5 que já estava
+    expect_same(list, std::vector<int>{1, 5, 5, 9});
+}
+
+TEST(SortedArrayListTest, BoundsMatchStandardLibrary) {
+    // int segue o caminho sem desvios; std::string, o comum.
+    structures::SortedArrayList<int> ints;
+    structures::SortedArrayList<std::string> strings;
+    std::vector<int> expected;
+    std::srand(19);
+    for (auto i = 0; i < 500; ++i) {
+        auto value = std::rand() % 100;
+        ints.insert(value);
+        strings.insert(std::to_string(value));
+        expected.insert(std::upper_bound(expected.begin(), expected.end(),
+                                         value), value);
+    }
+    expect_same(ints, expected);
+    std::vector<std::string> as_strings;
+    for (auto value : expected) {
+        as_strings.push_back(std::to_string(value));
+    }
+    std::sort(as_strings.begin(), as_strings.end());
+    expect_same(strings, as_strings);
+
+    for (auto value = -1; value <= 100; ++value) {
+        auto low = std::lower_bound(expected.begin(), expected.end(), value);
+        auto high = std::upper_bound(expected.begin(), expected.end(), value);
+        ASSERT_EQ(std::size_t(low - expected.begin()), ints.lower_bound(value));
+        ASSERT_EQ(std::size_t(high - expected.begin()),
+                  ints.upper_bound(value));
+        auto range = ints.equal_range(value);
+        ASSERT_EQ(ints.lower_bound(value), range.first);
+        ASSERT_EQ(ints.upper_bound(value), range.second);
+        ASSERT_EQ(std::size_t(high - low), ints.count(value));
+        ASSERT_EQ(low != high, ints.contains(value));
+        ASSERT_EQ(low != high ? ints.lower_bound(value) : ints.size(),
+                  ints.find(value));
+
+        auto key = std::to_string(value);
+        auto slow = std::lower_bound(as_strings.begin(), as_strings.end(),
+                                     key);
+        auto shigh = std::upper_bound(as_strings.begin(), as_strings.end(),
+                                      key);
+        ASSERT_EQ(std::size_t(slow - as_strings.begin()),
+                  strings.lower_bound(key));
+        ASSERT_EQ(std::size_t(shigh - slow), strings.count(key));
+    }
+}
+
+TEST(SortedArrayListTest, RemoveAndPop) {
+    structures::SortedArrayList<int> list;
+    for (auto value : {4, 2, 2, 8, 6}) {
+        list.insert(value);
+    }
+    list.remove(2);
+    expect_same(list, std::vector<int>{2, 4, 6, 8});
+    ASSERT_THROW(list.remove(3), std::out_of_range);
+    ASSERT_EQ(2, list.pop_front());
+    ASSERT_EQ(8, list.pop_back());
+    ASSERT_EQ(6, list.pop(1));
+    expect_same(list, std::vector<int>{4});
+    list.clear();
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(SortedArrayListTest, CustomCompare) {
+    structures::SortedArrayList<int, std::greater<int>> list;
+    for (auto value : {3, 7, 1, 7, 5}) {
+        list.insert(value);
+    }
+    expect_same(list, std::vector<int>{7, 7, 5, 3, 1});
+    ASSERT_EQ(2u, list.find(5));
+    ASSERT_EQ(2u, list.count(7));
+    ASSERT_EQ(3u, list.lower_bound(4));
+}
+
+TEST(SortedArrayListTest, FixedCapacity) {
+    structures::SortedArrayList<int> list(3);
+    ASSERT_EQ(3u, list.max_size());
+    list.insert(3);
+    list.insert(1);
+    list.insert(2);
+    ASSERT_TRUE(list.full());
+    ASSERT_THROW(list.insert(0), std::out_of_range);
+    expect_same(list, std::vector<int>{1, 2, 3});
+}
+
+TEST(SortedArrayListTest, InsertOwnElementWhileGrowing) {
+    structures::SortedArrayList<std::string> list;
+    list.insert(std::string(32, 'a'));
+    // A cópia deve ser feita antes de a lista realocar.
+    for (auto i = 0; i < 64; ++i) {
+        list.insert(list[list.size() - 1]);
+    }
+    ASSERT_EQ(65u, list.size());
+    ASSERT_EQ(65u, list.count(std::string(32, 'a')));
+}
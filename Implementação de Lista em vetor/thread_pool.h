@@ -0,0 +1,167 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_THREAD_POOL_H
+#define STRUCTURES_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>  // std::exception_ptr
+#include <functional>  // std::function
+#include <memory>  // std::shared_ptr
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace structures {
+
+/// Conjunto fixo de threads para os algoritmos paralelos. A thread que
+/// chama parallel_for também executa tarefas, então chamadas aninhadas
+/// não travam mesmo com todas as threads ocupadas.
+class ThreadPool {
+ public:
+    /// Cria threads auxiliares; 0 executa tudo na thread que chama
+    explicit ThreadPool(std::size_t threads);
+    /// Espera as tarefas pendentes e encerra as threads
+    ~ThreadPool();
+    /// Cópia não suportada
+    ThreadPool(const ThreadPool&) = delete;
+    /// Atribuição não suportada
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Executa task(i) para todo i em [0, tasks) e espera o término.
+    /// A primeira exceção lançada por uma tarefa é relançada aqui.
+    template<typename Task>
+    void parallel_for(std::size_t tasks, const Task& task);
+    /// Threads que podem trabalhar ao mesmo tempo (auxiliares + a que chama)
+    std::size_t concurrency() const;
+    /// Conjunto compartilhado, com uma thread por núcleo
+    static ThreadPool& shared();
+
+ private:
+    /// Estado de uma chamada de parallel_for, dividido com as auxiliares
+    struct Batch {
+        std::size_t tasks;
+        const std::function<void(std::size_t)>* task;
+        std::atomic<std::size_t> next{0};
+        std::size_t finished{0};
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+
+        /// Executa tarefas até acabarem
+        void work();
+    };
+
+    /// Laço de cada thread auxiliar
+    void worker_loop();
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> queue;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping{false};
+};
+
+}  // namespace structures
+
+inline structures::ThreadPool::ThreadPool(std::size_t threads) {
+    for (std::size_t i = 0; i < threads; i++) {
+        workers.emplace_back([this] { worker_loop(); });
+    }
+}
+
+inline structures::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+template<typename Task>
+void structures::ThreadPool::parallel_for(std::size_t tasks,
+                                          const Task& task) {
+    if (tasks == 0) {
+        return;
+    }
+    std::function<void(std::size_t)> function = std::cref(task);
+    auto batch = std::make_shared<Batch>();
+    batch->tasks = tasks;
+    batch->task = &function;
+    std::size_t helpers = tasks - 1 < workers.size() ? tasks - 1
+                                                     : workers.size();
+    if (helpers > 0) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (std::size_t i = 0; i < helpers; i++) {
+                // Auxiliares atrasadas só veem next >= tasks e saem sem
+                // tocar em task, que vive na pilha desta chamada.
+                queue.emplace_back([batch] { batch->work(); });
+            }
+        }
+        wake.notify_all();
+    }
+    batch->work();
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->done.wait(lock, [&batch] {
+        return batch->finished == batch->tasks;
+    });
+    if (batch->error) {
+        std::rethrow_exception(batch->error);
+    }
+}
+
+inline std::size_t structures::ThreadPool::concurrency() const {
+    return workers.size() + 1;
+}
+
+inline structures::ThreadPool& structures::ThreadPool::shared() {
+    static ThreadPool pool(std::thread::hardware_concurrency() > 1 ?
+                           std::thread::hardware_concurrency() - 1 : 0);
+    return pool;
+}
+
+inline void structures::ThreadPool::Batch::work() {
+    while (true) {
+        std::size_t index = next.fetch_add(1);
+        if (index >= tasks) {
+            return;
+        }
+        std::exception_ptr failure;
+        try {
+            (*task)(index);
+        } catch (...) {
+            failure = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (failure && !error) {
+            error = failure;
+        }
+        finished++;
+        if (finished == tasks) {
+            done.notify_all();
+        }
+    }
+}
+
+inline void structures::ThreadPool::worker_loop() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return;
+            }
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+        job();
+    }
+}
+
+#endif
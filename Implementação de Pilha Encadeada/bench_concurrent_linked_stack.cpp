@@ -0,0 +1,75 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// bench_concurrent_linked_stack.cpp
+///
+/// Vazão de pares push/pop com 1 a 32 threads (ou mais, se a máquina tiver):
+/// ConcurrentLinkedStack contra LinkedStack protegida por std::mutex.
+///
+///     g++ -std=c++14 -O2 -pthread bench_concurrent_linked_stack.cpp -o bench
+#include "concurrent_linked_stack.h"
+#include "linked_stack.h"
+#include "../benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+
+namespace {
+
+/// LinkedStack com um mutex em volta, como era usada até aqui
+class LockedStack {
+ public:
+    void push(int data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        stack.push(data);
+    }
+    bool try_pop(int& data) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stack.empty()) {
+            return false;
+        }
+        data = stack.pop();
+        return true;
+    }
+
+ private:
+    std::mutex mutex;
+    structures::LinkedStack<int> stack;
+};
+
+/// Milhões de operações por segundo com threads threads, cada uma fazendo
+/// pairs pares push/pop
+template<typename Stack>
+double throughput(unsigned threads, std::size_t pairs) {
+    Stack stack;
+    double elapsed = bench::run_threads(threads, [&](unsigned id) {
+        long sum = 0;
+        int data;
+        for (std::size_t i = 0; i < pairs; i++) {
+            stack.push(static_cast<int>(id + i));
+            if (stack.try_pop(data)) {
+                sum += data;
+            }
+        }
+        bench::keep(sum);
+    });
+    return 2.0 * threads * pairs / elapsed / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::size_t total = bench::scaled(8000000, bench::scale(argc, argv));
+    unsigned max = std::max(32u, bench::hardware_threads());
+
+    std::printf("%8s %18s %18s\n", "threads", "lock-free Mops/s",
+                "mutex Mops/s");
+    for (auto threads : bench::thread_counts(max)) {
+        std::size_t pairs = std::max<std::size_t>(total / threads, 1);
+        double lock_free =
+            throughput<structures::ConcurrentLinkedStack<int>>(threads,
+                                                               pairs);
+        double locked = throughput<LockedStack>(threads, pairs);
+        std::printf("%8u %18.2f %18.2f\n", threads, lock_free, locked);
+    }
+    return 0;
+}
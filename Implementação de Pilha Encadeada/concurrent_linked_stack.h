@@ -0,0 +1,232 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_CONCURRENT_LINKED_STACK_H
+#define STRUCTURES_CONCURRENT_LINKED_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>  /// std::hash
+#include <stdexcept>
+#include <thread>  /// std::this_thread::yield
+#include <utility>  /// std::move
+
+#include "hazard_pointers.h"
+
+namespace structures {
+
+/// Pilha encadeada lock-free (Treiber) com backoff por eliminação
+template<typename T>
+class ConcurrentLinkedStack {
+ public:
+    /// Construtor padrão
+    ConcurrentLinkedStack();
+    /// Destrutor (não pode haver acessos concorrentes)
+    ~ConcurrentLinkedStack();
+    /// Limpar pilha
+    void clear();
+    /// Empilha
+    void push(const T& data);
+    /// Empilha movendo o dado
+    void push(T&& data);
+    /// Desempilha
+    T pop();
+    /// Desempilha sem exceção; retorna false se vazia
+    bool try_pop(T& data);
+    /// Pilha vazia
+    bool empty() const;
+    /// Tamanho aproximado da pilha
+    std::size_t size() const;
+
+ private:
+    /// Elemento
+    struct Node {
+        explicit Node(const T& data_):
+            data{data_}
+        {}
+        explicit Node(T&& data_):
+            data{std::move(data_)}
+        {}
+
+        T data;
+        Node* next{nullptr};
+    };
+    /// Posição do vetor de eliminação, isolada em sua linha de cache
+    struct alignas(64) Slot {
+        std::atomic<Node*> offer{nullptr};
+    };
+
+    /// Empilha um nodo já alocado
+    void push_node(Node* node);
+    /// Tenta entregar o nodo direto a um pop concorrente
+    bool eliminate_push(Node* node);
+    /// Tenta receber um nodo de um push concorrente
+    Node* eliminate_pop();
+    /// Posição aleatória do vetor de eliminação
+    static std::size_t random_slot();
+    /// Marca de nodo já recebido por um pop
+    static Node* taken() {
+        static char marker;
+        return reinterpret_cast<Node*>(&marker);
+    }
+
+    static const std::size_t ELIMINATION_SIZE = 8;
+    static const int ELIMINATION_SPINS = 64;
+
+    /// Nodo-topo
+    alignas(64) std::atomic<Node*> top_;
+    /// Tamanho
+    alignas(64) std::atomic<std::size_t> size_;
+    /// Vetor de eliminação
+    Slot elimination[ELIMINATION_SIZE];
+};
+
+}  // namespace structures
+
+template<typename T>
+structures::ConcurrentLinkedStack<T>::ConcurrentLinkedStack() {
+    top_.store(nullptr);
+    size_.store(0);
+}
+
+template<typename T>
+structures::ConcurrentLinkedStack<T>::~ConcurrentLinkedStack() {
+    Node* current = top_.load();
+    while (current != nullptr) {
+        Node* next = current->next;
+        delete current;
+        current = next;
+    }
+}
+
+template<typename T>
+void structures::ConcurrentLinkedStack<T>::clear() {
+    T data;
+    while (try_pop(data)) {}
+}
+
+template<typename T>
+void structures::ConcurrentLinkedStack<T>::push(const T& data) {
+    push_node(new Node(data));
+}
+
+template<typename T>
+void structures::ConcurrentLinkedStack<T>::push(T&& data) {
+    push_node(new Node(std::move(data)));
+}
+
+template<typename T>
+T structures::ConcurrentLinkedStack<T>::pop() {
+    T data;
+    if (!try_pop(data)) {
+        throw std::out_of_range("pilha vazia");
+    }
+    return data;
+}
+
+template<typename T>
+bool structures::ConcurrentLinkedStack<T>::try_pop(T& data) {
+    while (true) {
+        Node* old_top = HazardPointers::protect(0, top_);
+        if (old_top == nullptr) {
+            HazardPointers::clear(0);
+            return false;
+        }
+        // old_top está protegido: não pode ser liberado nem reciclado (ABA).
+        Node* next = old_top->next;
+        if (top_.compare_exchange_weak(old_top, next)) {
+            HazardPointers::clear(0);
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            data = std::move(old_top->data);
+            HazardPointers::retire(old_top);
+            return true;
+        }
+        HazardPointers::clear(0);
+        // Contenção: tenta casar com um push concorrente.
+        Node* node = eliminate_pop();
+        if (node != nullptr) {
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            data = std::move(node->data);
+            delete node;
+            return true;
+        }
+    }
+}
+
+template<typename T>
+bool structures::ConcurrentLinkedStack<T>::empty() const {
+    return (top_.load() == nullptr);
+}
+
+template<typename T>
+std::size_t structures::ConcurrentLinkedStack<T>::size() const {
+    return size_.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+void structures::ConcurrentLinkedStack<T>::push_node(Node* node) {
+    // Conta antes de publicar o nodo: o pop que o receber só decrementa
+    // depois, então size() nunca fica abaixo de zero.
+    size_.fetch_add(1, std::memory_order_relaxed);
+    node->next = top_.load(std::memory_order_relaxed);
+    while (true) {
+        if (top_.compare_exchange_weak(node->next, node,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+            return;
+        }
+        // Contenção: tenta entregar direto a um pop concorrente.
+        if (eliminate_push(node)) {
+            return;
+        }
+        node->next = top_.load(std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+bool structures::ConcurrentLinkedStack<T>::eliminate_push(Node* node) {
+    std::atomic<Node*>& offer = elimination[random_slot()].offer;
+    Node* expected = nullptr;
+    if (!offer.compare_exchange_strong(expected, node)) {
+        return false;
+    }
+    for (int i = 0; i < ELIMINATION_SPINS; i++) {
+        if (offer.load(std::memory_order_acquire) == taken()) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+    // Retira a oferta; se falhar, um pop já recebeu o nodo.
+    expected = node;
+    if (offer.compare_exchange_strong(expected, nullptr)) {
+        return false;
+    }
+    offer.store(nullptr, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+typename structures::ConcurrentLinkedStack<T>::Node*
+structures::ConcurrentLinkedStack<T>::eliminate_pop() {
+    std::atomic<Node*>& offer = elimination[random_slot()].offer;
+    Node* node = offer.load(std::memory_order_acquire);
+    if (node == nullptr || node == taken()) {
+        return nullptr;
+    }
+    // Só o push dono limpa a marca, então o nodo não pode ser reoferecido
+    // neste slot antes de o recebermos.
+    if (offer.compare_exchange_strong(node, taken())) {
+        return node;
+    }
+    return nullptr;
+}
+
+template<typename T>
+std::size_t structures::ConcurrentLinkedStack<T>::random_slot() {
+    thread_local std::uint32_t state = static_cast<std::uint32_t>(
+        std::hash<std::thread::id>()(std::this_thread::get_id())) | 1u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state % ELIMINATION_SIZE;
+}
+
+#endif
@@ -0,0 +1,172 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_HAZARD_POINTERS_H
+#define STRUCTURES_HAZARD_POINTERS_H
+
+#include <algorithm>  /// std::sort, std::binary_search
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace structures {
+
+/// Ponteiros de risco (hazard pointers) para liberar nodos de estruturas
+/// lock-free apenas quando nenhuma thread pode mais acessá-los.
+class HazardPointers {
+ public:
+    /// Número máximo de threads usando ponteiros de risco ao mesmo tempo
+    static const std::size_t MAX_THREADS = 128;
+    /// Ponteiros de risco por thread
+    static const std::size_t SLOTS = 2;
+
+    /// Lê src e publica o valor no slot até que a leitura se estabilize
+    template<typename N>
+    static N* protect(std::size_t slot, const std::atomic<N*>& src);
+    /// Libera o slot
+    static void clear(std::size_t slot);
+    /// Agenda a liberação do nodo para quando não estiver protegido
+    template<typename N>
+    static void retire(N* node);
+
+ private:
+    /// Registro de uma thread
+    struct Record {
+        std::atomic<bool> active{false};
+        std::atomic<void*> hazard[SLOTS]{};
+    };
+    /// Nodo aguardando liberação
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+    };
+    /// Nodos de threads que terminaram antes de poder liberá-los
+    struct Orphans {
+        ~Orphans() {
+            for (auto& r : list) {
+                r.deleter(r.pointer);
+            }
+        }
+        std::mutex mutex;
+        std::vector<Retired> list;
+    };
+    /// Estado local de cada thread
+    struct ThreadState {
+        ThreadState();
+        ~ThreadState();
+        Record* record;
+        std::vector<Retired> retired;
+    };
+
+    /// Limite de nodos retirados antes de varrer os ponteiros de risco
+    static const std::size_t SCAN_THRESHOLD = 2 * MAX_THREADS * SLOTS;
+
+    static Record* records() {
+        static Record records_[MAX_THREADS];
+        return records_;
+    }
+    static Orphans& orphans() {
+        static Orphans orphans_;
+        return orphans_;
+    }
+    static ThreadState& local() {
+        thread_local ThreadState state;
+        return state;
+    }
+    /// Libera os nodos retirados que não estão protegidos
+    static void scan(std::vector<Retired>& retired);
+};
+
+}  // namespace structures
+
+inline structures::HazardPointers::ThreadState::ThreadState() {
+    // Garante que os órfãos sejam destruídos depois desta thread.
+    orphans();
+    Record* all = records();
+    for (std::size_t i = 0; i < MAX_THREADS; i++) {
+        bool expected = false;
+        if (all[i].active.compare_exchange_strong(expected, true)) {
+            record = &all[i];
+            return;
+        }
+    }
+    throw std::runtime_error("threads demais usando ponteiros de risco");
+}
+
+inline structures::HazardPointers::ThreadState::~ThreadState() {
+    for (std::size_t i = 0; i < SLOTS; i++) {
+        record->hazard[i].store(nullptr);
+    }
+    scan(retired);
+    if (!retired.empty()) {
+        Orphans& o = orphans();
+        std::lock_guard<std::mutex> lock(o.mutex);
+        o.list.insert(o.list.end(), retired.begin(), retired.end());
+    }
+    record->active.store(false);
+}
+
+template<typename N>
+N* structures::HazardPointers::protect(std::size_t slot,
+                                       const std::atomic<N*>& src) {
+    std::atomic<void*>& hazard = local().record->hazard[slot];
+    N* p = src.load();
+    while (true) {
+        hazard.store(p);
+        N* q = src.load();
+        if (q == p) {
+            return p;
+        }
+        p = q;
+    }
+}
+
+inline void structures::HazardPointers::clear(std::size_t slot) {
+    local().record->hazard[slot].store(nullptr, std::memory_order_release);
+}
+
+template<typename N>
+void structures::HazardPointers::retire(N* node) {
+    ThreadState& state = local();
+    state.retired.push_back({node, [](void* p) {
+        delete static_cast<N*>(p);
+    }});
+    if (state.retired.size() >= SCAN_THRESHOLD) {
+        scan(state.retired);
+    }
+}
+
+inline void structures::HazardPointers::scan(std::vector<Retired>& retired) {
+    {
+        // Adota nodos de threads que já terminaram.
+        Orphans& o = orphans();
+        std::unique_lock<std::mutex> lock(o.mutex, std::try_to_lock);
+        if (lock.owns_lock() && !o.list.empty()) {
+            retired.insert(retired.end(), o.list.begin(), o.list.end());
+            o.list.clear();
+        }
+    }
+    std::vector<void*> hazards;
+    Record* all = records();
+    for (std::size_t i = 0; i < MAX_THREADS; i++) {
+        for (std::size_t j = 0; j < SLOTS; j++) {
+            void* p = all[i].hazard[j].load();
+            if (p != nullptr) {
+                hazards.push_back(p);
+            }
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < retired.size(); i++) {
+        if (std::binary_search(hazards.begin(), hazards.end(),
+                               retired[i].pointer)) {
+            retired[kept++] = retired[i];
+        } else {
+            retired[i].deleter(retired[i].pointer);
+        }
+    }
+    retired.resize(kept);
+}
+
+#endif
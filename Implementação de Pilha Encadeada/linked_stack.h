@@ -3,17 +3,36 @@
 #define STRUCTURES_LINKED_STACK_H
 
 #include <cstdint>
+#include <memory>  // std::allocator, std::allocator_traits
+#include <stdexcept>
+#include <type_traits>  // std::true_type, std::false_type
+#include <utility>  // std::move
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
 
 namespace structures {
 
 /// Pilha Encadeada
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class LinkedStack {
  public:
+    using allocator_type = Allocator;
+
     /// Construtor padrão
     LinkedStack();
+    /// Construtor com alocador
+    explicit LinkedStack(const Allocator& allocator);
+    /// Construtor de cópia: copia os nodos em O(n)
+    LinkedStack(const LinkedStack& other);
+    /// Construtor de movimento: toma os nodos e o alocador de other em O(1)
+    LinkedStack(LinkedStack&& other) noexcept;
     /// Destrutor
     ~LinkedStack();
+    /// Atribuição por cópia; o alocador de cada pilha não muda
+    LinkedStack& operator=(const LinkedStack& other);
+    /// Atribuição por movimento: O(1) se os nodos puderem trocar de dono
+    LinkedStack& operator=(LinkedStack&& other);
     /// Limpar pilha
     void clear();
     /// Empilha
@@ -26,6 +45,8 @@ class LinkedStack {
     bool empty() const;
     /// Tamanho da pilha
     std::size_t size() const;
+    /// Alocador dos nodos
+    Allocator get_allocator() const;
 
  private:
     /// Elemento
@@ -63,37 +84,113 @@ class LinkedStack {
         T data_;
         Node* next_{nullptr};
     };
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Aloca e constrói um nodo
+    Node* create_node(const T& data, Node* next);
+    /// Destrói e libera um nodo
+    void destroy_node(Node* node);
+    /// Copia os dados de other, na mesma ordem, para a pilha vazia
+    void append(const LinkedStack& other);
+    /// Toma os nodos de other, que fica vazia
+    void steal(LinkedStack& other) noexcept;
+    /// Movimento quando o alocador acompanha os nodos
+    void move_assign(LinkedStack& other, std::true_type);
+    /// Movimento quando o alocador fica: só toma os nodos se for igual
+    void move_assign(LinkedStack& other, std::false_type);
+
+    /// Alocador de nodos
+    NodeAllocator allocator_;
     /// Nodo-topo
     Node* top_;
     /// Tamanho
     std::size_t size_;
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Pilha que aloca os nodos de um std::pmr::memory_resource
+template<typename T>
+using LinkedStack =
+    structures::LinkedStack<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
-#endif
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>::LinkedStack() {
+    top_ = nullptr;
+    size_ = 0;
+}
 
-template<typename T>
-structures::LinkedStack<T>::LinkedStack() {
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>::LinkedStack(
+        const Allocator& allocator):
+    allocator_{allocator} {
     top_ = nullptr;
     size_ = 0;
 }
 
-template<typename T>
-structures::LinkedStack<T>::~LinkedStack() {
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>::LinkedStack(
+        const LinkedStack& other):
+    allocator_{NodeTraits::select_on_container_copy_construction(
+        other.allocator_)} {
+    top_ = nullptr;
+    size_ = 0;
+    try {
+        append(other);
+    } catch (...) {
+        clear();
+        throw;
+    }
+}
+
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>::LinkedStack(
+        LinkedStack&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>::~LinkedStack() {
     clear();
 }
 
-template<typename T>
-void structures::LinkedStack<T>::clear() {
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>&
+structures::LinkedStack<T, Allocator>::operator=(const LinkedStack& other) {
+    if (this != &other) {
+        clear();
+        append(other);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::LinkedStack<T, Allocator>&
+structures::LinkedStack<T, Allocator>::operator=(LinkedStack&& other) {
+    if (this != &other) {
+        move_assign(other, typename NodeTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::clear() {
     while (size_ > 0) {
         pop();
     }
 }
 
-template<typename T>
-void structures::LinkedStack<T>::push(const T& data) {
-    Node *new_value = new Node(data, top_);
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::push(const T& data) {
+    Node *new_value = create_node(data, top_);
     if (new_value == nullptr) {
         throw std::out_of_range("pilha cheia");
     }
@@ -101,8 +198,8 @@ void structures::LinkedStack<T>::push(const T& data) {
     size_++;
 }
 
-template<typename T>
-T structures::LinkedStack<T>::pop() {
+template<typename T, typename Allocator>
+T structures::LinkedStack<T, Allocator>::pop() {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     } else {
@@ -110,13 +207,13 @@ T structures::LinkedStack<T>::pop() {
         T info_back = eliminate->data();
         top_ = top_->next();
         size_--;
-        delete eliminate;
+        destroy_node(eliminate);
         return info_back;
     }
 }
 
-template<typename T>
-T& structures::LinkedStack<T>::top() const {
+template<typename T, typename Allocator>
+T& structures::LinkedStack<T, Allocator>::top() const {
     if (empty()) {
         throw std::out_of_range("pilha vazia");
     } else {
@@ -124,12 +221,83 @@ T& structures::LinkedStack<T>::top() const {
     }
 }
 
-template<typename T>
-bool structures::LinkedStack<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::LinkedStack<T, Allocator>::empty() const {
     return (size_ == 0);
 }
 
-template<typename T>
-std::size_t structures::LinkedStack<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::LinkedStack<T, Allocator>::size() const {
     return size_;
 }
+
+template<typename T, typename Allocator>
+Allocator structures::LinkedStack<T, Allocator>::get_allocator() const {
+    return Allocator(allocator_);
+}
+
+template<typename T, typename Allocator>
+typename structures::LinkedStack<T, Allocator>::Node*
+structures::LinkedStack<T, Allocator>::create_node(const T& data, Node* next) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, data, next);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::append(const LinkedStack& other) {
+    // Copia do topo para a base, encadeando pelo fim.
+    Node* last = nullptr;
+    for (const Node* node = other.top_; node != nullptr; node = node->next()) {
+        Node* copy = create_node(node->data(), nullptr);
+        if (last == nullptr) {
+            top_ = copy;
+        } else {
+            last->next(copy);
+        }
+        last = copy;
+        size_++;
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::steal(LinkedStack& other) noexcept {
+    top_ = other.top_;
+    size_ = other.size_;
+    other.top_ = nullptr;
+    other.size_ = 0;
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::move_assign(
+        LinkedStack& other, std::true_type) {
+    clear();
+    allocator_ = std::move(other.allocator_);
+    steal(other);
+}
+
+template<typename T, typename Allocator>
+void structures::LinkedStack<T, Allocator>::move_assign(
+        LinkedStack& other, std::false_type) {
+    clear();
+    if (allocator_ == other.allocator_) {
+        steal(other);
+    } else {
+        // Nodos de outro alocador não podem ser liberados por este.
+        append(other);
+        other.clear();
+    }
+}
+
+#endif
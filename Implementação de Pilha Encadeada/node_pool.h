@@ -0,0 +1,187 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+#ifndef STRUCTURES_NODE_POOL_H
+#define STRUCTURES_NODE_POOL_H
+
+#include <cstdint>
+#include <memory>  /// std::align
+#include <mutex>
+#include <new>  /// ::operator new
+
+namespace structures {
+
+/// Reserva global de blocos de tamanho fixo. Os blocos vêm de lâminas
+/// (slabs) grandes e cada thread guarda um estoque local, de modo que
+/// alocar e liberar normalmente não trava nem chama malloc.
+template<std::size_t Size, std::size_t Align>
+class FixedSizePool {
+ public:
+    /// Um bloco de Size bytes alinhado em Align
+    static void* allocate();
+    /// Devolve um bloco obtido por allocate
+    static void deallocate(void* block);
+
+ private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    /// Estoque compartilhado entre as threads
+    struct Central {
+        std::mutex mutex;
+        FreeBlock* free_list{nullptr};
+    };
+    /// Estoque local de uma thread
+    struct Cache {
+        FreeBlock* head;
+        std::size_t count;
+        bool dead;  /// a thread já está terminando
+    };
+    /// Devolve o estoque local ao central quando a thread termina
+    struct Flusher {
+        ~Flusher();
+    };
+
+    static const std::size_t ALIGN =
+        Align > alignof(FreeBlock) ? Align : alignof(FreeBlock);
+    static const std::size_t RAW_SIZE =
+        Size > sizeof(FreeBlock) ? Size : sizeof(FreeBlock);
+    /// Tamanho do bloco arredondado para manter o alinhamento
+    static const std::size_t BLOCK_SIZE =
+        (RAW_SIZE + ALIGN - 1) / ALIGN * ALIGN;
+    static const std::size_t SLAB_BLOCKS = 256;
+    /// Blocos movidos de uma vez entre o estoque local e o central
+    static const std::size_t BATCH = 64;
+    static const std::size_t CACHE_LIMIT = 4 * BATCH;
+
+    /// Nunca é destruído: blocos podem ser liberados durante o término
+    /// do programa, depois dos destrutores estáticos.
+    static Central& central() {
+        static Central* instance = new Central;
+        return *instance;
+    }
+    static Cache& cache() {
+        thread_local Cache local{nullptr, 0, false};
+        thread_local Flusher flusher;
+        (void) flusher;
+        return local;
+    }
+    /// Traz até BATCH blocos do estoque central (ou de uma nova lâmina)
+    static void refill(Cache& local);
+    /// Devolve até n blocos do estoque local ao central
+    static void flush(Cache& local, std::size_t n);
+};
+
+/// Alocador compatível com a STL que atende alocações de um único
+/// objeto (como nodos de listas) pela FixedSizePool.
+template<typename T>
+class NodePoolAllocator {
+ public:
+    using value_type = T;
+
+    NodePoolAllocator() {}
+    template<typename U>
+    NodePoolAllocator(const NodePoolAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        if (n == 1) {
+            return static_cast<T*>(
+                FixedSizePool<sizeof(T), alignof(T)>::allocate());
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T* p, std::size_t n) {
+        if (n == 1) {
+            FixedSizePool<sizeof(T), alignof(T)>::deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+};
+
+template<typename T, typename U>
+bool operator==(const NodePoolAllocator<T>&, const NodePoolAllocator<U>&) {
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const NodePoolAllocator<T>&, const NodePoolAllocator<U>&) {
+    return false;
+}
+
+}  // namespace structures
+
+template<std::size_t Size, std::size_t Align>
+void* structures::FixedSizePool<Size, Align>::allocate() {
+    Cache& local = cache();
+    if (local.head == nullptr) {
+        refill(local);
+    }
+    FreeBlock* block = local.head;
+    local.head = block->next;
+    local.count--;
+    return block;
+}
+
+template<std::size_t Size, std::size_t Align>
+void structures::FixedSizePool<Size, Align>::deallocate(void* block) {
+    Cache& local = cache();
+    FreeBlock* free_block = static_cast<FreeBlock*>(block);
+    free_block->next = local.head;
+    local.head = free_block;
+    local.count++;
+    if (local.dead) {
+        flush(local, local.count);
+    } else if (local.count > CACHE_LIMIT) {
+        flush(local, BATCH);
+    }
+}
+
+template<std::size_t Size, std::size_t Align>
+structures::FixedSizePool<Size, Align>::Flusher::~Flusher() {
+    Cache& local = cache();
+    flush(local, local.count);
+    local.dead = true;
+}
+
+template<std::size_t Size, std::size_t Align>
+void structures::FixedSizePool<Size, Align>::refill(Cache& local) {
+    Central& shared = central();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    if (shared.free_list == nullptr) {
+        // Nova lâmina: todos os blocos vão para o estoque local.
+        std::size_t space = SLAB_BLOCKS * BLOCK_SIZE + ALIGN;
+        void* memory = ::operator new(space);
+        std::align(ALIGN, SLAB_BLOCKS * BLOCK_SIZE, memory, space);
+        char* slab = static_cast<char*>(memory);
+        for (std::size_t i = SLAB_BLOCKS; i > 0; i--) {
+            FreeBlock* block =
+                reinterpret_cast<FreeBlock*>(slab + (i - 1) * BLOCK_SIZE);
+            block->next = local.head;
+            local.head = block;
+        }
+        local.count += SLAB_BLOCKS;
+        return;
+    }
+    for (std::size_t i = 0; i < BATCH && shared.free_list != nullptr; i++) {
+        FreeBlock* block = shared.free_list;
+        shared.free_list = block->next;
+        block->next = local.head;
+        local.head = block;
+        local.count++;
+    }
+}
+
+template<std::size_t Size, std::size_t Align>
+void structures::FixedSizePool<Size, Align>::flush(Cache& local,
+                                                   std::size_t n) {
+    Central& shared = central();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    for (std::size_t i = 0; i < n && local.head != nullptr; i++) {
+        FreeBlock* block = local.head;
+        local.head = block->next;
+        local.count--;
+        block->next = shared.free_list;
+        shared.free_list = block;
+    }
+}
+
+#endif
@@ -0,0 +1,95 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_concurrent_linked_stack.cpp
+
+#include "gtest/gtest.h"
+#include "concurrent_linked_stack.h"
+#include "hazard_pointers.h"
+#include "concurrent_linked_stack.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(ConcurrentLinkedStackTest, PushAndPop) {
+    structures::ConcurrentLinkedStack<std::string> stack;
+    ASSERT_TRUE(stack.empty());
+    stack.push("a");
+    stack.push(std::string("b"));
+    ASSERT_EQ(2u, stack.size());
+    ASSERT_EQ("b", stack.pop());
+    ASSERT_EQ("a", stack.pop());
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(0u, stack.size());
+}
+
+TEST(ConcurrentLinkedStackTest, EmptyStack) {
+    structures::ConcurrentLinkedStack<int> stack;
+    int data = 0;
+    ASSERT_FALSE(stack.try_pop(data));
+    ASSERT_THROW(stack.pop(), std::out_of_range);
+}
+
+TEST(ConcurrentLinkedStackTest, MoveOnlyData) {
+    structures::ConcurrentLinkedStack<std::unique_ptr<int>> stack;
+    stack.push(std::unique_ptr<int>(new int(1)));
+    std::unique_ptr<int> data;
+    ASSERT_TRUE(stack.try_pop(data));
+    ASSERT_EQ(1, *data);
+}
+
+TEST(ConcurrentLinkedStackTest, Clear) {
+    structures::ConcurrentLinkedStack<int> stack;
+    for (auto i = 0; i < 100; ++i) {
+        stack.push(i);
+    }
+    stack.clear();
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(0u, stack.size());
+}
+
+TEST(ConcurrentLinkedStackTest, ConcurrentPushAndPop) {
+    const int threads = 4;
+    const int per_thread = 20000;
+    structures::ConcurrentLinkedStack<int> stack;
+    std::vector<std::atomic<int>> seen(threads * per_thread);
+    std::atomic<int> popped{0};
+    std::atomic<bool> size_wrapped{false};
+    std::vector<std::thread> workers;
+    for (auto t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (auto i = 0; i < per_thread; ++i) {
+                stack.push(t * per_thread + i);
+            }
+        });
+        workers.emplace_back([&] {
+            int data;
+            while (popped.load() < threads * per_thread) {
+                if (stack.try_pop(data)) {
+                    seen[data].fetch_add(1);
+                    popped.fetch_add(1);
+                }
+                if (stack.size() > static_cast<std::size_t>(
+                        threads * per_thread)) {
+                    size_wrapped.store(true);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    ASSERT_FALSE(size_wrapped.load());
+    ASSERT_TRUE(stack.empty());
+    ASSERT_EQ(0u, stack.size());
+    for (auto& count : seen) {
+        ASSERT_EQ(1, count.load());
+    }
+}
@@ -0,0 +1,138 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_linked_stack.cpp
+
+#include "gtest/gtest.h"
+#include "linked_stack.h"
+#include "node_pool.h"
+#include "linked_stack.h"
+#include "../Implementação de Fila Encadeada/node_pool.h"
+#include "../Implementação de Fila Encadeada/linked_queue.h"
+#include "../tests_memory_resource.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(LinkedStackTest, PushAndPop) {
+    structures::LinkedStack<std::string> stack;
+    stack.push("a");
+    stack.push("b");
+    ASSERT_EQ(2u, stack.size());
+    ASSERT_EQ("b", stack.top());
+    ASSERT_EQ("b", stack.pop());
+    ASSERT_EQ("a", stack.pop());
+    ASSERT_TRUE(stack.empty());
+    ASSERT_THROW(stack.pop(), std::out_of_range);
+}
+
+TEST(NodePoolAllocatorTest, StackAndQueueShareThePool) {
+    structures::LinkedStack<std::string,
+                            structures::NodePoolAllocator<std::string>> stack;
+    structures::LinkedQueue<std::string,
+                            structures::NodePoolAllocator<std::string>> queue;
+    for (auto round = 0; round < 3; ++round) {
+        for (auto i = 0; i < 1000; ++i) {
+            stack.push(std::to_string(i));
+            queue.enqueue(std::to_string(i));
+        }
+        for (auto i = 999; i >= 0; --i) {
+            ASSERT_EQ(std::to_string(i), stack.pop());
+        }
+        for (auto i = 0; i < 1000; ++i) {
+            ASSERT_EQ(std::to_string(i), queue.dequeue());
+        }
+    }
+    ASSERT_TRUE(stack.empty());
+    ASSERT_TRUE(queue.empty());
+}
+
+TEST(NodePoolAllocatorTest, BlocksAreAlignedAndDistinct) {
+    structures::NodePoolAllocator<long double> allocator;
+    std::vector<long double*> blocks;
+    for (auto i = 0; i < 600; ++i) {
+        long double* block = allocator.allocate(1);
+        ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(block) %
+                      alignof(long double));
+        *block = i;
+        blocks.push_back(block);
+    }
+    for (auto i = 0; i < 600; ++i) {
+        ASSERT_EQ(i, *blocks[i]);
+        allocator.deallocate(blocks[i], 1);
+    }
+    long double* array = allocator.allocate(4);
+    allocator.deallocate(array, 4);
+}
+
+TEST(NodePoolAllocatorTest, FreedOnAnotherThread) {
+    using Allocator = structures::NodePoolAllocator<int>;
+    std::vector<int*> blocks;
+    std::thread producer([&blocks] {
+        Allocator allocator;
+        for (auto i = 0; i < 10000; ++i) {
+            blocks.push_back(allocator.allocate(1));
+            *blocks.back() = i;
+        }
+    });
+    producer.join();
+    std::vector<std::thread> consumers;
+    for (auto t = 0; t < 4; ++t) {
+        consumers.emplace_back([&blocks, t] {
+            Allocator allocator;
+            for (auto i = t; i < 10000; i += 4) {
+                allocator.deallocate(blocks[i], 1);
+            }
+            // Reaproveita os blocos devolvidos por esta thread.
+            for (auto i = 0; i < 1000; ++i) {
+                allocator.deallocate(allocator.allocate(1), 1);
+            }
+        });
+    }
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+}
+
+#if __cplusplus >= 201703L
+TEST(LinkedStackAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::LinkedStack<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.push(std::move(value));
+        },
+        [](C& stack, int n) {
+            for (auto i = n - 1; i >= 0; --i) {
+                ASSERT_EQ(tests::long_value(i), stack.pop());
+            }
+        });
+}
+#endif
+
+#if __cplusplus >= 201703L
+TEST(LinkedQueueAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::LinkedQueue<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.enqueue(std::move(value));
+        },
+        [](C& queue, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_EQ(tests::long_value(i), queue.dequeue());
+            }
+        });
+}
+#endif
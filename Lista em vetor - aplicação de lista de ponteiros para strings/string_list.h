@@ -2,9 +2,11 @@
 #ifndef STRUCTURES_STRING_LIST_H
 #define STRUCTURES_STRING_LIST_H
 
+#include <algorithm>  /// std::move, std::move_backward
 #include <cstdint>
 #include <stdexcept>  /// C++ exceptions
 #include <cstring>
+#include <type_traits>  /// std::is_trivially_copyable
 
 
 namespace structures {
@@ -59,6 +61,9 @@ class ArrayList {
     const T& operator[](std::size_t index) const;
 
  protected:
+    /// Move [first, last) para dest (os intervalos podem se sobrepor)
+    static void move_range(T* first, T* last, T* dest);
+
     T* contents;
     std::size_t size_;
     std::size_t max_size_;
@@ -102,8 +107,6 @@ class ArrayListString : public ArrayList<char *> {
 
 }  // namespace structures
 
-#endif
-
 /// Metodos de ArrayList
 
 template<typename T>
@@ -147,11 +150,7 @@ void structures::ArrayList<T>::push_front(const T& data) {
         throw std::out_of_range("lista cheia");
     } else {
         size_++;
-        std::size_t position = size_;
-        while (position > 0) {
-            contents[position] = contents[position - 1];
-            position--;
-        }
+        move_range(contents, contents + size_, contents + 1);
         contents[0] = data;
     }
 }
@@ -165,11 +164,7 @@ void structures::ArrayList<T>::insert(const T& data, std::size_t index) {
             throw std::out_of_range("posicao invalida");
         }
         size_++;
-        std::size_t position = size_;
-        while (position > index) {
-            contents[position] = contents[position - 1];
-            position--;
-        }
+        move_range(contents + index, contents + size_, contents + index + 1);
         contents[index] = data;
     }
 }
@@ -197,11 +192,8 @@ T structures::ArrayList<T>::pop(std::size_t index) {
         } else {
             size_--;
             T value = contents[index];
-            std::size_t position = index;
-            while (position < size_+1) {
-                contents[position] = contents[position + 1];
-                position++;
-            }
+            move_range(contents + index + 1, contents + size_ + 2,
+                       contents + index);
             return value;
         }
     }
@@ -224,11 +216,7 @@ T structures::ArrayList<T>::pop_front() {
     } else {
         size_--;
         T value = contents[0];
-        std::size_t position = 0;
-        while (position < size_ + 1) {
-            contents[position] = contents[position + 1];
-            position++;
-        }
+        move_range(contents + 1, contents + size_ + 2, contents);
         return value;
     }
 }
@@ -324,6 +312,20 @@ const T& structures::ArrayList<T>::operator[](std::size_t index) const {
     return contents[index];
 }
 
+template<typename T>
+void structures::ArrayList<T>::move_range(T* first, T* last, T* dest) {
+    if (std::is_trivially_copyable<T>::value) {
+        // Ponteiros e tipos simples: um unico memmove.
+        std::memmove(static_cast<void*>(dest),
+                     static_cast<const void*>(first),
+                     (last - first) * sizeof(T));
+    } else if (dest < first) {
+        std::move(first, last, dest);
+    } else {
+        std::move_backward(first, last, dest + (last - first));
+    }
+}
+
 // Metodos de ArrayListString
 
 structures::ArrayListString::~ArrayListString() {
@@ -401,3 +403,5 @@ std::size_t structures::ArrayListString::find(const char *data) {
     }
     return position;
 }
+
+#endif
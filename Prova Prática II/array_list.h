@@ -3,8 +3,12 @@
 #ifndef STRUCTURES_ARRAY_LIST_H
 #define STRUCTURES_ARRAY_LIST_H
 
+#include <algorithm>  // std::copy, std::move, std::move_backward
 #include <cstdint>
+#include <cstring>  // std::memmove
 #include <stdexcept>  // C++ exceptions
+#include <type_traits>  // std::is_trivially_copyable
+#include <utility>  // std::swap
 
 namespace structures {
 
@@ -16,8 +20,18 @@ class ArrayList {
     ArrayList();
     /// Construtor com tamanho definido.
     explicit ArrayList(std::size_t max_size);
+    /// Construtor de cópia: uma alocação e uma cópia em bloco.
+    ArrayList(const ArrayList& other);
+    /// Construtor de movimento: toma o vetor de other em O(1).
+    ArrayList(ArrayList&& other) noexcept;
     /// Destrutor.
     ~ArrayList();
+    /// Atribuição por cópia.
+    ArrayList& operator=(const ArrayList& other);
+    /// Atribuição por movimento: O(1), other fica vazia.
+    ArrayList& operator=(ArrayList&& other) noexcept;
+    /// Troca o conteúdo com other em O(1).
+    void swap(ArrayList& other) noexcept;
 
     /// Limpa lista.
     void clear();
@@ -59,6 +73,9 @@ class ArrayList {
     const T& operator[](std::size_t index) const;
 
  private:
+    /// Move [first, last) para dest (os intervalos podem se sobrepor).
+    static void move_range(T* first, T* last, T* dest);
+
     T* contents;
     std::size_t size_;
     std::size_t max_size_;
@@ -84,11 +101,59 @@ structures::ArrayList<T>::ArrayList(std::size_t max_size) {
     size_ = 0;
 }
 
+template<typename T>
+structures::ArrayList<T>::ArrayList(const ArrayList& other) {
+    max_size_ = other.max_size_;
+    contents = new T[max_size_];
+    std::copy(other.contents, other.contents + other.size_, contents);
+    size_ = other.size_;
+}
+
+template<typename T>
+structures::ArrayList<T>::ArrayList(ArrayList&& other) noexcept {
+    max_size_ = other.max_size_;
+    contents = other.contents;
+    size_ = other.size_;
+    other.max_size_ = 0;
+    other.contents = nullptr;
+    other.size_ = 0;
+}
+
 template<typename T>
 structures::ArrayList<T>::~ArrayList() {
     delete []contents;
 }
 
+template<typename T>
+structures::ArrayList<T>& structures::ArrayList<T>::operator=(
+        const ArrayList& other) {
+    if (this != &other) {
+        ArrayList copy(other);
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T>
+structures::ArrayList<T>& structures::ArrayList<T>::operator=(
+        ArrayList&& other) noexcept {
+    if (this != &other) {
+        delete []contents;
+        contents = nullptr;
+        max_size_ = 0;
+        size_ = 0;
+        swap(other);
+    }
+    return *this;
+}
+
+template<typename T>
+void structures::ArrayList<T>::swap(ArrayList& other) noexcept {
+    std::swap(contents, other.contents);
+    std::swap(size_, other.size_);
+    std::swap(max_size_, other.max_size_);
+}
+
 template<typename T>
 void structures::ArrayList<T>::clear() {
     size_ = 0;
@@ -111,11 +176,7 @@ void structures::ArrayList<T>::insert(const T& data, std::size_t index) {
     } else if (index > size()) {
         throw std::out_of_range("invalid index");
     }
-    if (size() > 0) {
-        for (std::size_t i = size(); i > index; i--) {
-            contents[i] = contents[i-1];
-        }
-    }
+    move_range(contents + index, contents + size(), contents + index + 1);
     contents[index] = data;
     size_++;
 }
@@ -140,9 +201,7 @@ T structures::ArrayList<T>::pop(std::size_t index) {
         throw std::out_of_range("invalid index");
     }
     T data = contents[index];
-    for (std::size_t i = index; i < size()-1; i++) {
-        contents[i] = contents[i+1];
-    }
+    move_range(contents + index + 1, contents + size(), contents + index);
     size_--;
     return data;
 }
@@ -246,4 +305,18 @@ const T& structures::ArrayList<T>::operator[](std::size_t index) const {
     return at(index);
 }
 
+template<typename T>
+void structures::ArrayList<T>::move_range(T* first, T* last, T* dest) {
+    if (std::is_trivially_copyable<T>::value) {
+        // Tipos simples: um unico memmove.
+        std::memmove(static_cast<void*>(dest),
+                     static_cast<const void*>(first),
+                     (last - first) * sizeof(T));
+    } else if (dest < first) {
+        std::move(first, last, dest);
+    } else {
+        std::move_backward(first, last, dest + (last - first));
+    }
+}
+
 #endif
@@ -0,0 +1,161 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// benchmark.h
+///
+/// Apoio comum aos programas bench_*.cpp: cronômetro, percentis, contagem
+/// de threads e, opcionalmente, contagem de alocações. Cada bench é um
+/// programa à parte, compilado com otimização, por exemplo:
+///
+///     g++ -std=c++14 -O2 -pthread bench_x.cpp -o bench_x && ./bench_x
+///
+/// O primeiro argumento, se houver, multiplica a quantidade de trabalho
+/// (0.01 para uma rodada rápida).
+#ifndef STRUCTURES_BENCHMARK_H
+#define STRUCTURES_BENCHMARK_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+/// Fator de escala do trabalho, lido de argv[1]
+inline double scale(int argc, char* argv[]) {
+    return argc > 1 ? std::atof(argv[1]) : 1.0;
+}
+
+/// n multiplicado pela escala, no mínimo 1
+inline std::size_t scaled(std::size_t n, double factor) {
+    std::size_t result = static_cast<std::size_t>(n * factor);
+    return result > 0 ? result : 1;
+}
+
+/// Segundos desde start
+inline double since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// Menor tempo, em segundos, de repeat execuções de f()
+template<typename F>
+double seconds(F&& f, int repeat = 3) {
+    double best = 0;
+    for (int i = 0; i < repeat; i++) {
+        Clock::time_point start = Clock::now();
+        f();
+        double elapsed = since(start);
+        if (i == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+/// Impede que o otimizador descarte o cálculo de value
+template<typename T>
+inline void keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+/// Percentil p (entre 0 e 1) de samples; reordena samples
+inline double percentile(std::vector<double>& samples, double p) {
+    if (samples.empty()) {
+        return 0;
+    }
+    std::size_t index = static_cast<std::size_t>(p * (samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + index,
+                     samples.end());
+    return samples[index];
+}
+
+/// Threads de hardware (ao menos 1)
+inline unsigned hardware_threads() {
+    unsigned threads = std::thread::hardware_concurrency();
+    return threads > 0 ? threads : 1;
+}
+
+/// 1, 2, 4, ... até max, incluindo max
+inline std::vector<unsigned> thread_counts(unsigned max) {
+    std::vector<unsigned> counts;
+    for (unsigned t = 1; t < max; t *= 2) {
+        counts.push_back(t);
+    }
+    counts.push_back(max);
+    return counts;
+}
+
+/// Roda body(i) em threads threads, todas liberadas ao mesmo tempo, e
+/// devolve os segundos até a última terminar
+template<typename Body>
+double run_threads(unsigned threads, Body body) {
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; i++) {
+        workers.emplace_back([&, i] {
+            ready.fetch_add(1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            body(i);
+        });
+    }
+    while (ready.load() < threads) {
+        std::this_thread::yield();
+    }
+    Clock::time_point start = Clock::now();
+    go.store(true);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return since(start);
+}
+
+/// Alocações feitas por operator new (contadas só se o programa definir
+/// BENCHMARK_COUNT_ALLOCATIONS antes de incluir este arquivo)
+inline std::atomic<std::size_t>& allocations() {
+    static std::atomic<std::size_t> count{0};
+    return count;
+}
+
+/// Bytes pedidos a operator new (idem)
+inline std::atomic<std::size_t>& allocated_bytes() {
+    static std::atomic<std::size_t> bytes{0};
+    return bytes;
+}
+
+}  // namespace bench
+
+#ifdef BENCHMARK_COUNT_ALLOCATIONS
+// Substitui o operator new global; só pode aparecer num .cpp por programa.
+void* operator new(std::size_t bytes) {
+    bench::allocations().fetch_add(1, std::memory_order_relaxed);
+    bench::allocated_bytes().fetch_add(bytes, std::memory_order_relaxed);
+    void* memory = std::malloc(bytes > 0 ? bytes : 1);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+#endif
+
+#endif
@@ -0,0 +1,93 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_memory_resource.h
+///
+/// Apoio comum aos testes dos aliases structures::pmr::*: cada teste só
+/// diz como construir, preencher e ler o seu contêiner.
+#ifndef STRUCTURES_TESTS_MEMORY_RESOURCE_H
+#define STRUCTURES_TESTS_MEMORY_RESOURCE_H
+
+#if __cplusplus >= 201703L
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+namespace tests {
+
+/// Recurso que conta os bytes em uso, para ver por onde o contêiner aloca
+class CountingResource : public std::pmr::memory_resource {
+ public:
+    std::size_t in_use{0};
+
+ private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        in_use += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes,
+                       std::size_t alignment) override {
+        in_use -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+/// Texto longo o bastante para não caber na otimização de strings curtas
+inline std::string long_value(int i) {
+    return std::string(32, static_cast<char>('a' + i % 26)) +
+           std::to_string(i);
+}
+
+/// Confere o uso do recurso por Container:
+///  - make(resource) constrói vazio sobre resource;
+///  - push(container, value) insere;
+///  - check(container, n) confere long_value(0..n-1) (pode esvaziá-lo).
+/// A cópia vai para o recurso padrão, o movimento no mesmo recurso só rouba
+/// os dados, entre recursos diferentes realoca no destino, e nada vaza.
+template<typename Container, typename Make, typename Push, typename Check>
+void expect_uses_resource(Make make, Push push, Check check) {
+    const int n = 100;
+    CountingResource first, second;
+    {
+        Container container = make(&first);
+        for (auto i = 0; i < n; ++i) {
+            push(container, long_value(i));
+        }
+        ASSERT_GT(first.in_use, 0u);
+        ASSERT_EQ(&first, container.get_allocator().resource());
+
+        Container copy(container);
+        ASSERT_EQ(std::pmr::get_default_resource(),
+                  copy.get_allocator().resource());
+
+        // Mesmo recurso: nenhum elemento é realocado.
+        Container same = make(&first);
+        std::size_t before = first.in_use;
+        same = std::move(container);
+        ASSERT_LE(first.in_use, before);
+        ASSERT_EQ(static_cast<std::size_t>(n), same.size());
+
+        // Recursos diferentes: o destino realoca tudo em second.
+        Container moved = make(&second);
+        moved = std::move(same);
+        ASSERT_EQ(&second, moved.get_allocator().resource());
+        ASSERT_GT(second.in_use, 0u);
+        ASSERT_EQ(static_cast<std::size_t>(n), moved.size());
+        check(moved, n);
+        check(copy, n);
+    }
+    ASSERT_EQ(0u, first.in_use);
+    ASSERT_EQ(0u, second.in_use);
+}
+
+}  // namespace tests
+
+#endif
+
+#endif
@@ -3,17 +3,150 @@
 #define STRUCTURES_AVL_TREE_H
 
 #include <algorithm>
+#include <cstddef>  // std::ptrdiff_t
+#include <iterator>  // std::bidirectional_iterator_tag
+#include <memory>  // std::allocator, std::allocator_traits
+#include <type_traits>  // std::true_type, std::false_type
+#include <utility>  // std::move, std::swap
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#endif
+
 #include "array_list.h"
 
 
 namespace structures {
 
 /// Arvore AVL
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class AVLTree {
+    struct Node;
+
 public:
+    using allocator_type = Allocator;
+
+    /// Iterador bidirecional em ordem (esquerda, raiz, direita). Guarda o
+    /// caminho da raiz até o nodo atual, já que os nodos não conhecem o
+    /// pai; os dados são somente leitura para não quebrar a ordem.
+    class Iterator {
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iterator() {}
+
+        reference operator*() const {
+            return path.back()->data;
+        }
+        pointer operator->() const {
+            return &path.back()->data;
+        }
+        Iterator& operator++() {
+            const Node* node = path.back();
+            if (node->right != nullptr) {
+                path.push_back(node->right);
+                descend_left();
+            } else {
+                // Sobe enquanto vier da direita.
+                const Node* child;
+                do {
+                    child = path.back();
+                    path.pop_back();
+                } while (!path.empty() && path.back()->right == child);
+            }
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+        /// A partir de end() volta ao maior
+        Iterator& operator--() {
+            if (path.empty()) {
+                if (root != nullptr) {
+                    path.push_back(root);
+                    descend_right();
+                }
+                return *this;
+            }
+            const Node* node = path.back();
+            if (node->left != nullptr) {
+                path.push_back(node->left);
+                descend_right();
+            } else {
+                // Sobe enquanto vier da esquerda.
+                const Node* child;
+                do {
+                    child = path.back();
+                    path.pop_back();
+                } while (!path.empty() && path.back()->left == child);
+            }
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) {
+            return a.current() == b.current();
+        }
+        friend bool operator!=(const Iterator& a, const Iterator& b) {
+            return a.current() != b.current();
+        }
+
+     private:
+        friend class AVLTree;
+
+        explicit Iterator(const Node* root_):
+            root{root_}
+        {}
+
+        const Node* current() const {
+            return path.empty() ? nullptr : path.back();
+        }
+        void descend_left() {
+            while (path.back()->left != nullptr) {
+                path.push_back(path.back()->left);
+            }
+        }
+        void descend_right() {
+            while (path.back()->right != nullptr) {
+                path.push_back(path.back()->right);
+            }
+        }
+
+        const Node* root{nullptr};
+        std::vector<const Node*> path;
+    };
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    /// Construtor.
+    AVLTree() = default;
+    /// Construtor com alocador.
+    explicit AVLTree(const Allocator& allocator);
+    /// Construtor de cópia: copia a forma da árvore em O(n).
+    AVLTree(const AVLTree& other);
+    /// Construtor de cópia alocando com allocator.
+    AVLTree(const AVLTree& other, const Allocator& allocator);
+    /// Construtor de movimento: toma os nodos e o alocador de other em O(1).
+    AVLTree(AVLTree&& other) noexcept;
     /// Destrutor.
     ~AVLTree();
+    /// Atribuição por cópia; o alocador de cada árvore não muda.
+    AVLTree& operator=(const AVLTree& other);
+    /// Atribuição por movimento: O(1) se os nodos puderem trocar de dono.
+    AVLTree& operator=(AVLTree&& other);
+    /// Troca o conteúdo com other em O(1).
+    void swap(AVLTree& other) noexcept;
+    /// Alocador dos nodos.
+    Allocator get_allocator() const;
     /// Insere o elemento na arvore.
     void insert(const T& data);
     /// Remove o elemento da arvore.
@@ -24,7 +157,7 @@ public:
     bool empty() const;
     /// Retorna o numero de elementos da arvore.
     std::size_t size() const;
-    /// Retorna a altura da árvore.
+    /// Retorna a altura da árvore (0 com um nodo, -1 vazia).
     int height() const;
     /// Retorna os elementos na ordem raiz, esquerda e direita.
     ArrayList<T> pre_order() const;
@@ -32,6 +165,10 @@ public:
     ArrayList<T> in_order() const;
     /// Retorna os elementos na ordem esquerda, direita e raiz.
     ArrayList<T> post_order() const;
+    /// Menor elemento
+    const_iterator begin() const;
+    /// Depois do maior elemento
+    const_iterator end() const;
 
 private:
     struct Node {
@@ -39,19 +176,32 @@ private:
             data = data_;
         }
 
+        Node* clone(AVLTree& tree) const {
+            Node* node = tree.create_node(data);
+            node->height_ = height_;
+            if (left != nullptr) {
+                node->left = left->clone(tree);
+            }
+            if (right != nullptr) {
+                node->right = right->clone(tree);
+            }
+            return node;
+        }
+
         T data;
         int height_{0};
         Node* left{nullptr};
         Node* right{nullptr};
 
-        int height(Node* N) {
+        static int height(Node* N) {
+            // Folha tem altura 0, então a subárvore vazia tem -1.
             if (N == NULL) {
-                return 0;
+                return -1;
             }
             return N->height_;
         }
 
-        Node* simpleLeft(Node *k2) {
+        static Node* simpleLeft(Node *k2) {
             Node *k1 = k2->left;
             k2->left = k1->right;
             k1->right = k2;
@@ -62,7 +212,7 @@ private:
             return k1;
         }
 
-        Node* simpleRight(Node *k2) {
+        static Node* simpleRight(Node *k2) {
             Node *k1 = k2->right;
             k2->right = k1->left;
             k1->left = k2;
@@ -73,40 +223,39 @@ private:
             return k1;
         }
 
-        Node* doubleLeft(Node* k3) {
+        static Node* doubleLeft(Node* k3) {
             // Roda entre k1 e k2.
             k3->left = simpleRight(k3->left);
             // Roda entre k3 e k2.
             return simpleLeft(k3);
         }
 
-        Node* doubleRight(Node* k3) {
+        static Node* doubleRight(Node* k3) {
             // Roda entre k1 e k2.
             k3->right = simpleLeft(k3->right);
             // Roda entre k3 e k2.
             return simpleRight(k3);
         }
 
-        int get_balance(Node *node) {
+        static int get_balance(Node *node) {
             if (node == NULL) {
                 return 0;
             }
             return height(node->left) - height(node->right);
         }
 
-        Node* insert(Node* node, const T &data_) {
+        static Node* insert(Node* node, const T &data_, AVLTree& tree) {
             // Cria o nodo e retorna.
             if (node == NULL) {
-                Node* node = new Node(data_);
-                return node;
+                return tree.create_node(data_);
             }
             if (data_ < node->data) {
                 // Vai à esquerda.
-                node->left = insert(node->left, data_);
+                node->left = insert(node->left, data_, tree);
             }
             else if (data_ > node->data) {
                 // Vai à direita.
-                node->right = insert(node->right, data_);
+                node->right = insert(node->right, data_, tree);
             }
             else {
                 throw std::out_of_range("Elemento inválido.");
@@ -129,24 +278,24 @@ private:
             }
             // Esquerda-direita.
             if (balance > 1 && data_ > node->left->data) {
-                doubleLeft(node);
+                return doubleLeft(node);
             }
             // Direita-esquerda.
             if (balance < -1 && data_ < node->right->data) {
-                doubleRight(node);
+                return doubleRight(node);
             }
             // Retorna o nodo sem alteracoes.
             return node;
         }
 
-        Node* remove(const T &data_) {
+        Node* remove(const T &data_, AVLTree& tree) {
             Node *node = this;
             if (data_ < node->data) {
                 // Vai para esquerda.
-                node->left = node->left->remove(data_);
-            } else if (data > node->data) {
+                node->left = node->left->remove(data_, tree);
+            } else if (data_ > node->data) {
                 // Vai para direita.
-                node->right = node->right->remove(data_);
+                node->right = node->right->remove(data_, tree);
             } else {
                 // Esse é o nodo a ser deletado.
                 if ((node->left == NULL) || (node->right == NULL)) {
@@ -157,11 +306,11 @@ private:
 
                     // Se não há nenhum filho.
                     if (tmp == NULL) {
-                        tmp = node;
+                        tree.destroy_node(node);
                         node = NULL;
                     } else {
                         *node = *tmp;  // Copia os dados.
-                        delete tmp;
+                        tree.destroy_node(tmp);
                     }
                 } else {
                     // 2 filhos.
@@ -170,7 +319,7 @@ private:
                     // Copia somente o valor para o nodo atual.
                     node->data = tmp->data;
                     // Deleta o sucessor.
-                    node->right = node->right->remove(tmp->data);
+                    node->right = node->right->remove(tmp->data, tree);
                 }
             }
             if (node == NULL) {
@@ -200,9 +349,9 @@ private:
             return node;
         }
 
-        Node *minimum(Node *node) {
+        static Node *minimum(Node *node) {
             Node *now = node;
-            if (node->left != NULL) return node->minimum(node->left);
+            if (node->left != NULL) return minimum(node->left);
 
             return now;
         }
@@ -258,37 +407,126 @@ private:
             v.push_back(data);
         }
     };
-
+    using NodeAllocator = typename std::allocator_traits<
+        Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /// Aloca e constrói um nodo.
+    Node* create_node(const T& data);
+    /// Destrói e libera um nodo.
+    void destroy_node(Node* node);
+    /// Troca os nodos com other, sem mexer nos alocadores.
+    void steal(AVLTree& other) noexcept;
+    /// Movimento quando o alocador acompanha os nodos.
+    void move_assign(AVLTree& other, std::true_type);
+    /// Movimento quando o alocador fica: só toma os nodos se for igual.
+    void move_assign(AVLTree& other, std::false_type);
+    /// Troca os alocadores, se eles acompanham a troca.
+    void swap_allocator(AVLTree& other, std::true_type) noexcept;
+    void swap_allocator(AVLTree& other, std::false_type) noexcept;
+    /// Libera a subárvore de node.
+    void destroy(Node* node);
+
+    NodeAllocator allocator_;
     Node* root{nullptr};
     std::size_t size_{0u};
 };
 
+#if __cplusplus >= 201703L
+namespace pmr {
+/// Árvore que aloca os nodos de um std::pmr::memory_resource
+template<typename T>
+using AVLTree =
+    structures::AVLTree<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+#endif
+
 }  // namespace structures
 
-#endif
+template<typename T, typename Allocator>
+structures::AVLTree<T, Allocator>::AVLTree(const Allocator& allocator):
+    allocator_{allocator}
+{}
+
+template<typename T, typename Allocator>
+structures::AVLTree<T, Allocator>::AVLTree(const AVLTree& other):
+    AVLTree(other, NodeTraits::select_on_container_copy_construction(
+        other.allocator_))
+{}
+
+template<typename T, typename Allocator>
+structures::AVLTree<T, Allocator>::AVLTree(const AVLTree& other,
+                                           const Allocator& allocator):
+    allocator_{allocator} {
+    if (other.root != nullptr) {
+        root = other.root->clone(*this);
+    }
+    size_ = other.size_;
+}
 
-template<typename T>
-structures::AVLTree<T>::~AVLTree() {
+template<typename T, typename Allocator>
+structures::AVLTree<T, Allocator>::AVLTree(AVLTree&& other) noexcept:
+    allocator_{std::move(other.allocator_)} {
+    steal(other);
 }
 
-template<typename T>
-void structures::AVLTree<T>::insert(const T &data) {
-    root = root->insert(root, data);
+template<typename T, typename Allocator>
+structures::AVLTree<T, Allocator>&
+structures::AVLTree<T, Allocator>::operator=(const AVLTree& other) {
+    if (this != &other) {
+        AVLTree copy(other, get_allocator());
+        swap(copy);
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+structures::AVLTree<T, Allocator>&
+structures::AVLTree<T, Allocator>::operator=(AVLTree&& other) {
+    if (this != &other) {
+        move_assign(other, typename NodeTraits::
+                    propagate_on_container_move_assignment());
+    }
+    return *this;
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::swap(AVLTree& other) noexcept {
+    steal(other);
+    swap_allocator(other,
+                   typename NodeTraits::propagate_on_container_swap());
+}
+
+template<typename T, typename Allocator>
+Allocator structures::AVLTree<T, Allocator>::get_allocator() const {
+    return Allocator(allocator_);
+}
+
+template<typename T, typename Allocator>
+structures::AVLTree<T, Allocator>::~AVLTree() {
+    destroy(root);
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::insert(const T &data) {
+    root = Node::insert(root, data, *this);
     size_++;
 }
 
-template<typename T>
-void structures::AVLTree<T>::remove(const T& data) {
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::remove(const T& data) {
     if (empty()) {
         throw std::out_of_range("Arvore vazia!");
+    } else if (!contains(data)) {
+        throw std::out_of_range("Elemento inválido.");
     } else {
-        root = root->remove(data);
+        root = root->remove(data, *this);
         size_--;
     }
 }
 
-template<typename T>
-bool structures::AVLTree<T>::contains(const T& data) const {
+template<typename T, typename Allocator>
+bool structures::AVLTree<T, Allocator>::contains(const T& data) const {
     if (root != nullptr) {
         return root->contains(data);
     } else {
@@ -296,45 +534,130 @@ bool structures::AVLTree<T>::contains(const T& data) const {
     }
 }
 
-template<typename T>
-bool structures::AVLTree<T>::empty() const {
+template<typename T, typename Allocator>
+bool structures::AVLTree<T, Allocator>::empty() const {
     return size_ == 0 ? true : false;
 }
 
-template<typename T>
-std::size_t structures::AVLTree<T>::size() const {
+template<typename T, typename Allocator>
+std::size_t structures::AVLTree<T, Allocator>::size() const {
     return size_;
 }
 
 
-template<typename T>
-int structures::AVLTree<T>::height() const {
-    return root->height(root);
+template<typename T, typename Allocator>
+int structures::AVLTree<T, Allocator>::height() const {
+    return Node::height(root);
 }
 
-template<typename T>
-structures::ArrayList<T> structures::AVLTree<T>::pre_order() const {
-    structures::ArrayList<T> v;
+template<typename T, typename Allocator>
+structures::ArrayList<T> structures::AVLTree<T, Allocator>::pre_order() const {
+    structures::ArrayList<T> v(size_, true);
     if (root != nullptr) {
         root->pre_order(v);
     }
     return v;
 }
 
-template<typename T>
-structures::ArrayList<T> structures::AVLTree<T>::in_order() const {
-    structures::ArrayList<T> v;
+template<typename T, typename Allocator>
+structures::ArrayList<T> structures::AVLTree<T, Allocator>::in_order() const {
+    structures::ArrayList<T> v(size_, true);
     if (root != nullptr) {
         root->in_order(v);
     }
     return v;
 }
 
-template<typename T>
-structures::ArrayList<T> structures::AVLTree<T>::post_order() const {
-    structures::ArrayList<T> v;
+template<typename T, typename Allocator>
+structures::ArrayList<T> structures::AVLTree<T, Allocator>::post_order() const {
+    structures::ArrayList<T> v(size_, true);
     if (root != nullptr) {
         root->post_order(v);
     }
     return v;
 }
+
+template<typename T, typename Allocator>
+typename structures::AVLTree<T, Allocator>::const_iterator
+structures::AVLTree<T, Allocator>::begin() const {
+    const_iterator it(root);
+    if (root != nullptr) {
+        it.path.push_back(root);
+        it.descend_left();
+    }
+    return it;
+}
+
+template<typename T, typename Allocator>
+typename structures::AVLTree<T, Allocator>::const_iterator
+structures::AVLTree<T, Allocator>::end() const {
+    return const_iterator(root);
+}
+
+template<typename T, typename Allocator>
+typename structures::AVLTree<T, Allocator>::Node*
+structures::AVLTree<T, Allocator>::create_node(const T& data) {
+    Node* node = NodeTraits::allocate(allocator_, 1);
+    try {
+        NodeTraits::construct(allocator_, node, data);
+    } catch (...) {
+        NodeTraits::deallocate(allocator_, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::destroy_node(Node* node) {
+    NodeTraits::destroy(allocator_, node);
+    NodeTraits::deallocate(allocator_, node, 1);
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::destroy(Node* node) {
+    if (node != nullptr) {
+        destroy(node->left);
+        destroy(node->right);
+        destroy_node(node);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::steal(AVLTree& other) noexcept {
+    std::swap(root, other.root);
+    std::swap(size_, other.size_);
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::move_assign(AVLTree& other,
+                                                    std::true_type) {
+    // Os nodos antigos são destruídos junto com old, pelo alocador antigo.
+    AVLTree old(std::move(other));
+    steal(old);
+    std::swap(allocator_, old.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::move_assign(AVLTree& other,
+                                                    std::false_type) {
+    AVLTree old(std::move(other));
+    if (allocator_ == old.allocator_) {
+        steal(old);
+    } else {
+        // Nodos de outro alocador não podem ser liberados por este.
+        AVLTree copy(old, get_allocator());
+        steal(copy);
+    }
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::swap_allocator(
+        AVLTree& other, std::true_type) noexcept {
+    std::swap(allocator_, other.allocator_);
+}
+
+template<typename T, typename Allocator>
+void structures::AVLTree<T, Allocator>::swap_allocator(
+        AVLTree&, std::false_type) noexcept {}
+
+#endif
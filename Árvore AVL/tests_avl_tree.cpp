@@ -0,0 +1,196 @@
+/// Copyright [2021] <Alisson Fabra da Silva>
+/// tests_avl_tree.cpp
+
+#include "gtest/gtest.h"
+#include "avl_tree.h"
+#include "avl_tree.h"
+#include "../tests_memory_resource.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#if __cplusplus >= 202002L
+// Os iteradores satisfazem o conceito de std::ranges esperado.
+static_assert(std::ranges::bidirectional_range<structures::AVLTree<int>>);
+static_assert(std::ranges::bidirectional_range<const structures::AVLTree<int>>);
+static_assert(!std::ranges::random_access_range<structures::AVLTree<int>>);
+#endif
+
+namespace {
+
+/// Altura máxima de uma AVL com n nodos, contando a folha como 0
+int max_height(std::size_t n) {
+    return static_cast<int>(1.4405 * std::log2(n + 2.0) - 1.3277);
+}
+
+/// Confere tamanho, ordem, iteração e balanceamento contra expected
+void expect_same(const structures::AVLTree<int>& tree,
+                 const std::set<int>& expected) {
+    ASSERT_EQ(expected.size(), tree.size());
+    auto in_order = tree.in_order();
+    ASSERT_EQ(expected.size(), in_order.size());
+    auto it = expected.begin();
+    for (std::size_t i = 0; i < in_order.size(); ++i, ++it) {
+        ASSERT_EQ(*it, in_order.at(i));
+    }
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), tree.begin()));
+    ASSERT_EQ(static_cast<std::ptrdiff_t>(expected.size()),
+              std::distance(tree.begin(), tree.end()));
+    if (!expected.empty()) {
+        ASSERT_LE(tree.height(), max_height(expected.size()));
+    }
+}
+
+}  // namespace
+
+TEST(AVLTreeTest, DoubleRotationsOnInsert) {
+    // Esquerda-direita e direita-esquerda.
+    structures::AVLTree<int> left_right;
+    for (auto value : {30, 10, 20}) {
+        left_right.insert(value);
+    }
+    expect_same(left_right, {10, 20, 30});
+    ASSERT_EQ(20, left_right.pre_order().at(0));
+    ASSERT_EQ(1, left_right.height());
+
+    structures::AVLTree<int> right_left;
+    for (auto value : {10, 30, 20}) {
+        right_left.insert(value);
+    }
+    expect_same(right_left, {10, 20, 30});
+    ASSERT_EQ(20, right_left.pre_order().at(0));
+}
+
+TEST(AVLTreeTest, RemoveGoesRight) {
+    structures::AVLTree<int> tree;
+    for (auto value : {20, 10, 30, 25, 40}) {
+        tree.insert(value);
+    }
+    tree.remove(40);
+    tree.remove(25);
+    expect_same(tree, {10, 20, 30});
+    ASSERT_THROW(tree.remove(99), std::out_of_range);
+    ASSERT_THROW(tree.insert(10), std::out_of_range);
+    expect_same(tree, {10, 20, 30});
+}
+
+TEST(AVLTreeTest, RandomInsertAndRemove) {
+    structures::AVLTree<int> tree;
+    std::set<int> expected;
+    std::srand(25);
+    for (auto i = 0; i < 3000; ++i) {
+        auto value = std::rand() % 500;
+        if (expected.count(value) == 0) {
+            tree.insert(value);
+            expected.insert(value);
+        } else {
+            tree.remove(value);
+            expected.erase(value);
+        }
+        if (i % 100 == 0) {
+            expect_same(tree, expected);
+        }
+    }
+    expect_same(tree, expected);
+    while (!expected.empty()) {
+        tree.remove(*expected.begin());
+        expected.erase(expected.begin());
+    }
+    expect_same(tree, expected);
+    ASSERT_TRUE(tree.empty());
+}
+
+TEST(AVLTreeIteratorTest, RangeForAndDecrementFromEnd) {
+    structures::AVLTree<int> tree;
+    ASSERT_TRUE(tree.begin() == tree.end());
+    for (auto i = 0; i < 100; ++i) {
+        tree.insert((i * 37) % 100);
+    }
+    auto expected = 0;
+    for (auto value : tree) {
+        ASSERT_EQ(expected++, value);
+    }
+    ASSERT_EQ(100, expected);
+    auto it = tree.end();
+    for (auto i = 99; i >= 0; --i) {
+        ASSERT_EQ(i, *--it);
+    }
+    ASSERT_TRUE(it == tree.begin());
+}
+
+TEST(AVLTreeIteratorTest, StandardAlgorithms) {
+    structures::AVLTree<std::string> tree;
+    for (auto word : {"pera", "uva", "maca", "banana", "kiwi"}) {
+        tree.insert(word);
+    }
+    ASSERT_EQ("banana", *tree.begin());
+    ASSERT_EQ("uva", *std::prev(tree.end()));
+    auto it = std::find(tree.begin(), tree.end(), "maca");
+    ASSERT_EQ(4u, it->size());
+    ASSERT_EQ("kiwi", *std::prev(it));
+    ASSERT_EQ(3, std::count_if(tree.begin(), tree.end(),
+                               [](const std::string& s) {
+                                   return s.size() == 4;
+                               }));
+    std::vector<std::string> reversed(
+        std::reverse_iterator<structures::AVLTree<std::string>::iterator>(
+            tree.end()),
+        std::reverse_iterator<structures::AVLTree<std::string>::iterator>(
+            tree.begin()));
+    ASSERT_EQ((std::vector<std::string>{"uva", "pera", "maca", "kiwi",
+                                        "banana"}), reversed);
+}
+
+TEST(AVLTreeTest, CopyAndMove) {
+    structures::AVLTree<int> tree;
+    std::set<int> expected;
+    for (auto i = 0; i < 50; ++i) {
+        tree.insert(i);
+        expected.insert(i);
+    }
+    structures::AVLTree<int> copy(tree);
+    tree.remove(0);
+    expect_same(copy, expected);
+    structures::AVLTree<int> moved(std::move(copy));
+    expect_same(moved, expected);
+    ASSERT_TRUE(copy.empty());
+    copy = moved;
+    expect_same(copy, expected);
+}
+
+#if __cplusplus >= 201703L
+TEST(AVLTreeAllocatorTest, UsesTheMemoryResource) {
+    using C = structures::pmr::AVLTree<std::string>;
+    tests::expect_uses_resource<C>(
+        [](std::pmr::memory_resource* resource) {
+            return C(resource);
+        },
+        [](C& container, std::string value) {
+            container.insert(std::move(value));
+        },
+        [](C& tree, int n) {
+            for (auto i = 0; i < n; ++i) {
+                ASSERT_TRUE(tree.contains(tests::long_value(i)));
+            }
+            auto in_order = tree.in_order();
+            for (std::size_t i = 1; i < in_order.size(); ++i) {
+                ASSERT_LT(in_order.at(i - 1), in_order.at(i));
+            }
+        });
+}
+#endif